@@ -0,0 +1,280 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_AWAITABLE_H
+#define SIGC_AWAITABLE_H
+
+#include <sigc++config.h>
+#include <sigc++/signal.h>
+
+/* C++20 coroutine support. The awaitables are only available if the compiler
+ * supports coroutines, e.g. with -std=c++20. libsigc++ itself is built as C++17.
+ */
+#if defined(__cpp_impl_coroutine) && defined(__cpp_concepts) && __has_include(<coroutine>)
+#define SIGC_HAVE_COROUTINES 1
+#endif
+
+#ifdef SIGC_HAVE_COROUTINES
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+/** Awaitable that is returned by signal_with_accumulator::next().
+ * When it's awaited, a one-shot slot is connected to the signal. The next
+ * emission stores its arguments in the awaiter, disconnects the slot, and
+ * resumes the coroutine before it invokes the following slots.
+ *
+ * If the coroutine is destroyed while it's suspended, the slot is
+ * disconnected. If the signal is destroyed or cleared, the coroutine is
+ * never resumed.
+ */
+template<typename T_return, typename... T_arg>
+class signal_next_awaiter
+{
+public:
+  using result_type = std::tuple<std::decay_t<T_arg>...>;
+
+  explicit signal_next_awaiter(const std::shared_ptr<signal_impl>& impl) noexcept : impl_(impl) {}
+
+  signal_next_awaiter(const signal_next_awaiter& src) = delete;
+  signal_next_awaiter& operator=(const signal_next_awaiter& src) = delete;
+  signal_next_awaiter(signal_next_awaiter&& src) = delete;
+  signal_next_awaiter& operator=(signal_next_awaiter&& src) = delete;
+
+  ~signal_next_awaiter() { connection_.disconnect(); }
+
+  inline bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    handle_ = handle;
+    slot<T_return(T_arg...)> resumer(
+      [this](type_trait_take_t<T_arg>... a) -> T_return
+      {
+        result_.emplace(std::forward<type_trait_take_t<T_arg>>(a)...);
+        connection_.disconnect();
+
+        // The awaiter may be destroyed by the resumed coroutine, and the slot
+        // is destroyed after the emission, so nothing must be accessed afterwards.
+        handle_.resume();
+        return T_return();
+      });
+    connection_ = connection(*impl_->connect(std::move(resumer)));
+
+    // The signal_impl must not be kept alive by a suspended coroutine.
+    impl_.reset();
+  }
+
+  inline result_type await_resume() { return std::move(*result_); }
+
+private:
+  std::shared_ptr<signal_impl> impl_;
+  std::coroutine_handle<> handle_;
+  connection connection_;
+  std::optional<result_type> result_;
+};
+
+/** Returns the object that is used to await an object of type @e T_awaitable,
+ * i.e. the result of its member or non-member operator co_await(),
+ * or the object itself.
+ */
+template<typename T_awaitable>
+decltype(auto)
+get_awaiter(T_awaitable&& awaitable)
+{
+  if constexpr (requires { std::forward<T_awaitable>(awaitable).operator co_await(); })
+    return std::forward<T_awaitable>(awaitable).operator co_await();
+  else if constexpr (requires { operator co_await(std::forward<T_awaitable>(awaitable)); })
+    return operator co_await(std::forward<T_awaitable>(awaitable));
+  else
+    return std::forward<T_awaitable>(awaitable);
+}
+
+/// The type of a co_await expression whose operand has type @e T_awaitable.
+template<typename T_awaitable>
+using await_result_t = decltype(get_awaiter(std::declval<T_awaitable>()).await_resume());
+
+/** A coroutine that starts immediately, and destroys itself when it has finished.
+ * signal_emit_async awaits the result of each slot in one of them.
+ */
+struct async_slot_task
+{
+  struct promise_type
+  {
+    inline async_slot_task get_return_object() const noexcept { return {}; }
+    inline std::suspend_never initial_suspend() const noexcept { return {}; }
+    inline std::suspend_never final_suspend() const noexcept { return {}; }
+    inline void return_void() const noexcept {}
+    inline void unhandled_exception() const noexcept { std::terminate(); }
+  };
+};
+
+/** Awaitable that is returned by signal_with_accumulator::emit_async().
+ * The constructor invokes the slots. Each slot returns an awaitable, which is
+ * awaited by an async_slot_task. Thus the slots run concurrently, and their
+ * results are collected in the order of completion. When the last one has
+ * completed, the coroutine that awaits the emission is resumed, and the results
+ * are passed to the accumulator. Since every slot has been invoked by then,
+ * an accumulator that stops early can't skip any slots.
+ *
+ * The awaitables of the slots may complete in other threads.
+ */
+template<typename T_return, typename T_accumulator, typename... T_arg>
+class signal_emit_async
+{
+public:
+  using slot_type = slot<T_return(T_arg...)>;
+  using call_type = typename slot_type::call_type;
+  using value_type = await_result_t<T_return>;
+
+  signal_emit_async(const std::shared_ptr<signal_impl>& impl, type_trait_take_t<T_arg>... a)
+  : state_(std::make_shared<state>())
+  {
+    if (!impl || impl->slots_.empty())
+      return;
+
+    signal_impl_exec_holder exec(impl.get());
+    const temp_slot_list slots(impl->slots_);
+
+    for (const auto& slot : slots)
+    {
+      if (slot.empty() || slot.blocked())
+        continue;
+
+      // Count the slot before it can complete.
+      state_->pending_.fetch_add(1, std::memory_order_relaxed);
+      await_slot(state_, (sigc::internal::function_pointer_cast<call_type>(slot.rep_->call_))(
+                           slot.rep_, std::forward<type_trait_take_t<T_arg>>(a)...));
+    }
+  }
+
+  signal_emit_async(const signal_emit_async& src) = delete;
+  signal_emit_async& operator=(const signal_emit_async& src) = delete;
+  signal_emit_async(signal_emit_async&& src) = delete;
+  signal_emit_async& operator=(signal_emit_async&& src) = delete;
+
+  inline bool await_ready() const noexcept
+  {
+    return state_->pending_.load(std::memory_order_acquire) == 1;
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) noexcept
+  {
+    state_->continuation_ = handle;
+
+    // Release the count of the emission itself. If all slots have completed
+    // in the meantime, don't suspend.
+    return state_->pending_.fetch_sub(1, std::memory_order_acq_rel) != 1;
+  }
+
+  auto await_resume()
+  {
+    if (state_->exception_)
+      std::rethrow_exception(state_->exception_);
+
+    if constexpr (std::is_void_v<value_type>)
+      return;
+    else if constexpr (std::is_void_v<T_accumulator>)
+      return std::move(state_->results_);
+    else
+    {
+      T_accumulator accumulator;
+      return accumulator(state_->results_.begin(), state_->results_.end());
+    }
+  }
+
+private:
+  // The void results of void slots are not stored.
+  struct no_results
+  {
+  };
+
+  struct state
+  {
+    /// The number of slots that have not completed, plus 1 until the emission is awaited.
+    std::atomic<std::size_t> pending_{ 1 };
+
+    std::coroutine_handle<> continuation_;
+
+    /// Guards results_ and exception_ while slots complete.
+    std::mutex mutex_;
+    std::conditional_t<std::is_void_v<value_type>, no_results,
+      std::vector<std::decay_t<value_type>>>
+      results_;
+    std::exception_ptr exception_;
+  };
+
+#if defined(__GNUC__) && !defined(__clang__)
+// g++ warns about the code that it generates for coroutine frames.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
+#endif
+  static async_slot_task await_slot(std::shared_ptr<state> st, T_return awaitable)
+  {
+    try
+    {
+      if constexpr (std::is_void_v<value_type>)
+        co_await std::move(awaitable);
+      else
+      {
+        auto result = co_await std::move(awaitable);
+        const std::lock_guard<std::mutex> lock(st->mutex_);
+        st->results_.push_back(std::move(result));
+      }
+    }
+    catch (...)
+    {
+      const std::lock_guard<std::mutex> lock(st->mutex_);
+      if (!st->exception_)
+        st->exception_ = std::current_exception();
+    }
+
+    if (st->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      st->continuation_.resume();
+  }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+  /// Shared with the async_slot_tasks, so the emission may be destroyed before they complete.
+  std::shared_ptr<state> state_;
+};
+
+} /* namespace internal */
+
+} /* namespace sigc */
+
+#endif // SIGC_HAVE_COROUTINES
+
+#endif /* SIGC_AWAITABLE_H */
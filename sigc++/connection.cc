@@ -22,16 +22,25 @@
 namespace sigc
 {
 
-connection::connection() noexcept : slot_(nullptr) {}
+connection::connection() noexcept : handle_{ internal::slot_handle::invalid_index, 0 } {}
 
-connection::connection(slot_base& slot) : slot_(&slot) {}
+connection::connection(slot_base& slot)
+: handle_{ internal::slot_handle::invalid_index, 0 }
+{
+  if (slot.rep_)
+  {
+    // The handle shall refer to this slot only.
+    slot.unshare();
+    handle_ = slot.rep_->handle(&slot);
+  }
+}
 
-connection::connection(const connection& c) : slot_(c.slot_) {}
+connection::connection(const connection& c) noexcept : handle_(c.handle_) {}
 
 connection&
-connection::operator=(const connection& src)
+connection::operator=(const connection& src) noexcept
 {
-  set_slot(src.slot_);
+  handle_ = src.handle_;
   return *this;
 }
 
@@ -40,7 +49,8 @@ connection::~connection() {}
 bool
 connection::empty() const noexcept
 {
-  return (!slot_ || slot_->empty());
+  const auto s = slot();
+  return (!s || s->empty());
 }
 
 bool
@@ -52,26 +62,29 @@ connection::connected() const noexcept
 bool
 connection::blocked() const noexcept
 {
-  return (slot_ ? slot_->blocked() : false);
+  const auto s = slot();
+  return (s ? s->blocked() : false);
 }
 
 bool
 connection::block(bool should_block) noexcept
 {
-  return (slot_ ? slot_->block(should_block) : false);
+  const auto s = slot();
+  return (s ? s->block(should_block) : false);
 }
 
 bool
 connection::unblock() noexcept
 {
-  return (slot_ ? slot_->unblock() : false);
+  const auto s = slot();
+  return (s ? s->unblock() : false);
 }
 
 void
 connection::disconnect()
 {
-  if (slot_)
-    slot_->disconnect(); // This notifies slot_'s parent.
+  if (const auto s = slot())
+    s->disconnect(); // This notifies the slot's parent.
 }
 
 connection::operator bool() const noexcept
@@ -82,7 +95,7 @@ connection::operator bool() const noexcept
 void
 connection::set_slot(const sigc::internal::weak_raw_ptr<slot_base>& sl)
 {
-  slot_ = sl;
+  *this = sl ? connection(*sl.operator->()) : connection();
 }
 
 } /* namespace sigc */
@@ -47,6 +47,10 @@ namespace sigc
  * of the slot to the signal. See also @ref sigc::scoped_connection, which does
  * disconnect automatically when the connection object is destroyed or replaced.
  *
+ * A %sigc::connection is a plain index and generation into a table of slots.
+ * Copying it copies those two numbers, and empty() only compares the generation
+ * with the one in the table. Connection objects can be kept in containers cheaply.
+ *
  * @ingroup signal
  */
 struct SIGC_API connection
@@ -57,7 +61,7 @@ struct SIGC_API connection
   /** Constructs a connection object copying an existing one.
    * @param c The connection object to make a copy from.
    */
-  connection(const connection& c);
+  connection(const connection& c) noexcept;
 
   /** Constructs a connection object from a slot object.
    * @param slot The slot to operate on.
@@ -67,7 +71,7 @@ struct SIGC_API connection
   /** Overrides this connection object copying another one.
    * @param src The connection object to make a copy from.
    */
-  connection& operator=(const connection& src);
+  connection& operator=(const connection& src) noexcept;
 
   ~connection();
 
@@ -107,12 +111,19 @@ struct SIGC_API connection
   explicit operator bool() const noexcept;
 
 private:
+  friend struct connection_group;
+
+  // Not used. It's kept, like the copy constructor, the copy assignment
+  // operator and the destructor, for ABI compatibility.
   void set_slot(const sigc::internal::weak_raw_ptr<slot_base>& sl);
 
-  /* Referred slot. Set to nullptr when the referred slot is deleted.
-   * A value of nullptr indicates an "empty" connection.
+  /// Returns the referred slot, or @p nullptr if it has been deleted.
+  inline slot_base* slot() const noexcept { return internal::slot_handle_table::lookup(handle_); }
+
+  /* Handle of the referred slot. It becomes stale when the referred slot is deleted.
+   * An invalid or stale handle indicates an "empty" connection.
    */
-  sigc::internal::weak_raw_ptr<slot_base> slot_;
+  internal::slot_handle handle_;
 };
 
 } /* namespace sigc */
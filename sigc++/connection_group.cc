@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#include <sigc++/connection_group.h>
+#include <sigc++/signal_base.h>
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+// Holds the execution counters of the signals that are affected by
+// connection_group::disconnect(). While a signal is held, the invalidation
+// of its slots only marks it for a sweep. When it's released, it sweeps once.
+struct signal_impl_batch
+{
+  explicit signal_impl_batch(std::vector<sigc::internal::signal_impl*>&& impls) noexcept
+  : impls_(std::move(impls))
+  {
+    for (auto impl : impls_)
+      impl->reference_exec();
+  }
+
+  signal_impl_batch(const signal_impl_batch& src) = delete;
+  signal_impl_batch& operator=(const signal_impl_batch& src) = delete;
+
+  ~signal_impl_batch()
+  {
+    for (auto impl : impls_)
+      impl->unreference_exec();
+  }
+
+  std::vector<sigc::internal::signal_impl*> impls_;
+};
+} // anonymous namespace
+
+namespace sigc
+{
+
+connection_group::connection_group(connection_group&& src) noexcept
+: connections_(std::move(src.connections_))
+{
+  src.connections_.clear();
+}
+
+connection_group&
+connection_group::operator=(connection_group&& src)
+{
+  disconnect();
+  connections_ = std::move(src.connections_);
+  src.connections_.clear();
+  return *this;
+}
+
+connection_group::~connection_group()
+{
+  disconnect();
+}
+
+void
+connection_group::add(const connection& c)
+{
+  if (connections_.size() == connections_.capacity())
+  {
+    connections_.erase(std::remove_if(connections_.begin(), connections_.end(),
+                         [](const connection& conn) { return conn.empty(); }),
+      connections_.end());
+  }
+  connections_.push_back(c);
+}
+
+void
+connection_group::disconnect()
+{
+  auto connections = std::move(connections_);
+  connections_.clear();
+
+  std::vector<internal::signal_impl*> impls;
+  for (const auto& c : connections)
+  {
+    if (const auto slot = c.slot())
+    {
+      if (const auto impl = internal::signal_impl::owner(*slot))
+        impls.push_back(impl);
+    }
+  }
+  std::sort(impls.begin(), impls.end());
+  impls.erase(std::unique(impls.begin(), impls.end()), impls.end());
+
+  signal_impl_batch batch(std::move(impls));
+
+  // Slots that are connected to a held signal are erased by its sweep.
+  for (const auto& c : connections)
+  {
+    if (const auto slot = c.slot())
+      slot->disconnect();
+  }
+}
+
+std::vector<connection>
+connection_group::release() noexcept
+{
+  return std::exchange(connections_, std::vector<connection>());
+}
+
+} /* namespace sigc */
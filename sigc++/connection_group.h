@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_CONNECTION_GROUP_HPP
+#define SIGC_CONNECTION_GROUP_HPP
+
+#include <sigc++/connection.h>
+#include <cstddef>
+#include <vector>
+
+namespace sigc
+{
+
+/** Owner of many connections, which are disconnected together.
+ *
+ * A connection_group holds connections to slots of any number of signals.
+ * disconnect() disconnects all of them in one pass, and so does the
+ * destructor. Like @ref sigc::scoped_connection, a connection_group can be
+ * moved, but not copied.
+ *
+ * Disconnecting the slots one by one erases them from their signals one by
+ * one. disconnect() instead holds each affected signal while it disconnects
+ * the slots, so that each signal removes all of its disconnected slots in a
+ * single sweep afterwards.
+ *
+ * @code
+ * struct Widget
+ * {
+ *   Widget(Model& model)
+ *   {
+ *     connections_ += model.signal_changed.connect(sigc::mem_fun(*this, &Widget::on_changed));
+ *     connections_ += model.signal_removed.connect(sigc::mem_fun(*this, &Widget::on_removed));
+ *   }
+ *
+ *   // ~connection_group() disconnects both slots.
+ *   sigc::connection_group connections_;
+ * };
+ * @endcode
+ *
+ * @ingroup signal
+ */
+struct SIGC_API connection_group final
+{
+  using size_type = std::size_t;
+
+  /** Constructs an empty connection group. */
+  connection_group() noexcept = default;
+
+  connection_group(const connection_group&) = delete;
+  connection_group& operator=(const connection_group&) = delete;
+
+  /** Constructs a connection group, moving the connections of another one.
+   * @param src The connection group to move from. It's left empty.
+   */
+  connection_group(connection_group&& src) noexcept;
+
+  /** Disconnects the connections of this group, and moves those of another one.
+   * @param src The connection group to move from. It's left empty.
+   */
+  connection_group& operator=(connection_group&& src);
+
+  /// Disconnects all connections of the group.
+  ~connection_group();
+
+  /** Adds a connection to the group.
+   * Connections whose slots have been disconnected in the meantime are
+   * forgotten before the group's storage grows.
+   * @param c The connection to disconnect with the others.
+   */
+  void add(const connection& c);
+
+  /** Adds a connection to the group.
+   * @param c The connection to disconnect with the others.
+   * @return @p this.
+   */
+  inline connection_group& operator+=(const connection& c)
+  {
+    add(c);
+    return *this;
+  }
+
+  /** Returns the number of connections in the group.
+   * It includes connections whose slots have been disconnected separately.
+   */
+  inline size_type size() const noexcept { return connections_.size(); }
+
+  /// Returns whether the group holds no connections.
+  inline bool empty() const noexcept { return connections_.empty(); }
+
+  /** Disconnects all connections of the group, and empties it.
+   * Each affected signal removes the slots in one pass.
+   */
+  void disconnect();
+
+  /** Empties the group without disconnecting its connections.
+   * @return The connections that the group held.
+   */
+  std::vector<connection> release() noexcept;
+
+private:
+  std::vector<connection> connections_;
+};
+
+} /* namespace sigc */
+
+#endif /* SIGC_CONNECTION_GROUP_HPP */
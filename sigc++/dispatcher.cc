@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#include <sigc++/dispatcher.h>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace sigc
+{
+
+namespace internal
+{
+
+mpsc_queue::mpsc_queue() noexcept : head_(&stub_), tail_(&stub_) {}
+
+void
+mpsc_queue::push(mpsc_node* node) noexcept
+{
+  node->next_.store(nullptr, std::memory_order_relaxed);
+  auto prev = head_.exchange(node, std::memory_order_acq_rel);
+  // Between the exchange and this store, the queue is disconnected at prev.
+  // pop() treats that like an empty queue.
+  prev->next_.store(node, std::memory_order_release);
+}
+
+mpsc_node*
+mpsc_queue::pop() noexcept
+{
+  auto tail = tail_;
+  auto next = tail->next_.load(std::memory_order_acquire);
+
+  if (tail == &stub_)
+  {
+    if (!next)
+      return nullptr;
+
+    tail_ = next;
+    tail = next;
+    next = next->next_.load(std::memory_order_acquire);
+  }
+
+  if (next)
+  {
+    tail_ = next;
+    return tail;
+  }
+
+  if (tail != head_.load(std::memory_order_acquire))
+    return nullptr; // A producer is in the middle of push().
+
+  // tail is the last node. Push the stub behind it, so that tail can be returned.
+  push(&stub_);
+
+  next = tail->next_.load(std::memory_order_acquire);
+  if (next)
+  {
+    tail_ = next;
+    return tail;
+  }
+
+  return nullptr;
+}
+
+} /* namespace internal */
+
+dispatcher::dispatcher() noexcept : pending_(false) {}
+
+dispatcher::~dispatcher()
+{
+  while (auto node = queue_.pop())
+    delete static_cast<internal::queued_call*>(node);
+}
+
+void
+dispatcher::post(internal::queued_call* call) noexcept
+{
+  queue_.push(call);
+
+  // The call is in the queue before pending_ is set. If dispatch() has already
+  // cleared pending_, it either finds the call or is woken again.
+  if (!pending_.exchange(true))
+    wake();
+}
+
+std::size_t
+dispatcher::dispatch()
+{
+  // Acknowledge the wake-up before pending_ is cleared. A call that's posted
+  // after that wakes the receiving thread again.
+  acknowledge();
+  pending_.store(false);
+
+  std::size_t count = 0;
+  while (auto node = queue_.pop())
+  {
+    std::unique_ptr<internal::queued_call> call(static_cast<internal::queued_call*>(node));
+    try
+    {
+      call->invoke();
+    }
+    catch (...)
+    {
+      // Make sure that the remaining calls are dispatched later.
+      if (!pending_.exchange(true))
+        wake();
+      throw;
+    }
+    ++count;
+  }
+  return count;
+}
+
+#ifdef __linux__
+eventfd_dispatcher::eventfd_dispatcher() : fd_(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+{
+  if (fd_ < 0)
+    throw std::system_error(errno, std::generic_category(), "eventfd");
+}
+
+eventfd_dispatcher::~eventfd_dispatcher()
+{
+  close(fd_);
+}
+
+void
+eventfd_dispatcher::wake() noexcept
+{
+  const std::uint64_t value = 1;
+  ssize_t result;
+  do
+    result = write(fd_, &value, sizeof(value));
+  while (result < 0 && errno == EINTR);
+}
+
+void
+eventfd_dispatcher::acknowledge() noexcept
+{
+  std::uint64_t value = 0;
+  ssize_t result;
+  do
+    result = read(fd_, &value, sizeof(value));
+  while (result < 0 && errno == EINTR);
+}
+#endif // __linux__
+
+} /* namespace sigc */
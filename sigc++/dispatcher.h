@@ -0,0 +1,300 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_DISPATCHER_H
+#define SIGC_DISPATCHER_H
+
+#include <sigc++config.h>
+#include <sigc++/visit_each.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+/// A link in the queue of a sigc::dispatcher.
+struct SIGC_API mpsc_node
+{
+  std::atomic<mpsc_node*> next_{ nullptr };
+};
+
+/// A function call that has been queued in a sigc::dispatcher.
+struct SIGC_API queued_call : public mpsc_node
+{
+  queued_call() = default;
+
+  queued_call(const queued_call& src) = delete;
+  queued_call& operator=(const queued_call& src) = delete;
+  queued_call(queued_call&& src) = delete;
+  queued_call& operator=(queued_call&& src) = delete;
+
+  virtual ~queued_call() = default;
+
+  /// Performs the call. This is executed by the thread that dispatches the queue.
+  virtual void invoke() = 0;
+};
+
+/** Intrusive multi-producer, single-consumer queue.
+ * push() is wait-free and can be called from any thread.
+ * pop() must only be called by one thread at a time.
+ * See Dmitry Vyukov's intrusive MPSC node-based queue.
+ */
+class SIGC_API mpsc_queue
+{
+public:
+  mpsc_queue() noexcept;
+
+  mpsc_queue(const mpsc_queue& src) = delete;
+  mpsc_queue& operator=(const mpsc_queue& src) = delete;
+  mpsc_queue(mpsc_queue&& src) = delete;
+  mpsc_queue& operator=(mpsc_queue&& src) = delete;
+
+  /// Adds @a node at the end of the queue.
+  void push(mpsc_node* node) noexcept;
+
+  /** Removes the node at the front of the queue.
+   * @return The node, or @p nullptr if the queue is empty, or if a producer
+   *         has not finished its push() yet. In the latter case the producer
+   *         finishes soon, and a later pop() returns the node.
+   */
+  mpsc_node* pop() noexcept;
+
+private:
+  /// The node that was pushed last. Producers exchange it.
+  std::atomic<mpsc_node*> head_;
+
+  /// The node at the front. Only the consumer accesses it.
+  mpsc_node* tail_;
+
+  /// A placeholder that keeps the queue from becoming empty.
+  mpsc_node stub_;
+};
+
+} /* namespace internal */
+
+/** Queue of function calls that shall be performed by a specific thread.
+ * Any thread may post() calls. The receiving thread performs them in dispatch(),
+ * usually from its event loop. wake() is called whenever a call has been posted
+ * to an idle dispatcher, so that the event loop can schedule the dispatch().
+ *
+ * Posting a call allocates memory for the call and its arguments, but takes no lock.
+ *
+ * See sigc::queued() and sigc::eventfd_dispatcher.
+ *
+ * @ingroup signal
+ */
+class SIGC_API dispatcher
+{
+public:
+  dispatcher() noexcept;
+
+  dispatcher(const dispatcher& src) = delete;
+  dispatcher& operator=(const dispatcher& src) = delete;
+  dispatcher(dispatcher&& src) = delete;
+  dispatcher& operator=(dispatcher&& src) = delete;
+
+  /// Deletes the calls that have not been dispatched, without performing them.
+  virtual ~dispatcher();
+
+  /** Queues a call. Can be called from any thread.
+   * @param call The call. The dispatcher takes ownership of it.
+   */
+  void post(internal::queued_call* call) noexcept;
+
+  /** Performs all queued calls. Must be called by the receiving thread only.
+   * If a call throws an exception, the remaining calls stay in the queue,
+   * and wake() is called again.
+   * @return The number of calls that have been taken from the queue,
+   *         including calls of disconnected slots, which are discarded.
+   */
+  std::size_t dispatch();
+
+protected:
+  /** Tells the receiving thread that dispatch() shall be called.
+   * It's called by post(), possibly from another thread.
+   */
+  virtual void wake() noexcept = 0;
+
+  /// Called by dispatch() before the queued calls are performed.
+  virtual void acknowledge() noexcept {}
+
+private:
+  internal::mpsc_queue queue_;
+
+  /// Whether wake() has been called, and dispatch() has not yet started.
+  std::atomic<bool> pending_;
+};
+
+#ifdef __linux__
+/** Dispatcher that signals pending calls with a Linux eventfd.
+ * Add fd() to the receiving thread's poll(), select() or epoll set,
+ * and call dispatch() when it's readable.
+ *
+ * @par Example:
+ * @code
+ * sigc::eventfd_dispatcher disp;
+ * sig.connect(sigc::queued(disp, sigc::mem_fun(receiver, &Receiver::on_event)));
+ * // In the receiving thread's loop:
+ * pollfd pfd{ disp.fd(), POLLIN, 0 };
+ * if (poll(&pfd, 1, -1) > 0)
+ *   disp.dispatch();
+ * @endcode
+ *
+ * This class is only available on Linux.
+ *
+ * @ingroup signal
+ */
+class SIGC_API eventfd_dispatcher : public dispatcher
+{
+public:
+  /** Creates the eventfd.
+   * @throw std::system_error if the eventfd can't be created.
+   */
+  eventfd_dispatcher();
+
+  ~eventfd_dispatcher() override;
+
+  /// Returns the file descriptor that becomes readable when calls are pending.
+  inline int fd() const noexcept { return fd_; }
+
+protected:
+  void wake() noexcept override;
+  void acknowledge() noexcept override;
+
+private:
+  int fd_;
+};
+#endif // __linux__
+
+namespace internal
+{
+
+template<typename T_functor, typename... T_arg>
+struct queued_functor_call : public queued_call
+{
+  template<typename... T_value>
+  explicit queued_functor_call(const std::shared_ptr<T_functor>& functor, T_value&&... a)
+  : functor_(functor), args_(std::forward<T_value>(a)...)
+  {
+  }
+
+  void invoke() override
+  {
+    // The connection may have been destroyed after the call was posted.
+    if (const auto functor = functor_.lock())
+      std::apply(*functor, std::move(args_));
+  }
+
+  std::weak_ptr<T_functor> functor_;
+  std::tuple<T_arg...> args_;
+};
+
+} /* namespace internal */
+
+/** Adaptor that queues calls of a functor in a sigc::dispatcher.
+ * Use the convenience function sigc::queued() to create an instance.
+ *
+ * @ingroup signal
+ */
+template<typename T_functor>
+class queued_functor
+{
+public:
+  queued_functor(dispatcher& d, const T_functor& functor)
+  : dispatcher_(&d), functor_(std::make_shared<T_functor>(functor))
+  {
+  }
+
+  /** Captures the arguments and queues a call of the functor.
+   * The arguments are copied, or moved if they are rvalue references.
+   * @param a Arguments to be passed on to the functor in the receiving thread.
+   */
+  template<typename... T_arg>
+  void operator()(T_arg&&... a) const
+  {
+    using call_type = internal::queued_functor_call<T_functor, std::decay_t<T_arg>...>;
+    dispatcher_->post(new call_type(functor_, std::forward<T_arg>(a)...));
+  }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  dispatcher* dispatcher_;
+
+  /* Shared by the copies of this queued_functor. Queued calls hold weak pointers,
+   * so they are discarded when all copies have been destroyed, e.g. because
+   * the slot has been disconnected.
+   */
+  std::shared_ptr<T_functor> functor_;
+#endif
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/** Performs a functor on each of the targets of a functor.
+ * The function overload for sigc::queued_functor performs a functor
+ * on the functor stored in the sigc::queued_functor object.
+ *
+ * @ingroup signal
+ */
+template<typename T_functor>
+struct visitor<queued_functor<T_functor>>
+{
+  template<typename T_action>
+  static void do_visit_each(const T_action& action, const queued_functor<T_functor>& target)
+  {
+    sigc::visit_each(action, *target.functor_);
+  }
+};
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** Creates a functor that queues its calls in a dispatcher, like a Qt queued connection.
+ * Connect it to a signal that is emitted in one thread, and @a functor is
+ * invoked by the thread that calls @a d.dispatch():
+ * @code
+ * sig.connect(sigc::queued(disp, sigc::mem_fun(receiver, &Receiver::on_event)));
+ * @endcode
+ * The arguments of the emission are copied, or moved if they are rvalue references.
+ * The return value of @a functor is discarded. Queued calls are discarded
+ * if the slot is disconnected before they are dispatched.
+ *
+ * If @a functor refers to a sigc::trackable, that object must be destroyed
+ * by the receiving thread, and only while the signal is not emitted.
+ *
+ * @param d The dispatcher of the receiving thread.
+ * @param functor The functor to invoke in the receiving thread.
+ * @return A functor that queues calls of @a functor.
+ *
+ * @ingroup signal
+ */
+template<typename T_functor>
+inline queued_functor<T_functor>
+queued(dispatcher& d, const T_functor& functor)
+{
+  return queued_functor<T_functor>(d, functor);
+}
+
+} /* namespace sigc */
+
+#endif /* SIGC_DISPATCHER_H */
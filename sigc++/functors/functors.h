@@ -19,6 +19,7 @@
 #define SIGC_FUNCTOR_HPP
 
 #include <sigc++/functors/slot.h>
+#include <sigc++/functors/slot_ref.h>
 #include <sigc++/functors/ptr_fun.h>
 #include <sigc++/functors/mem_fun.h>
 
@@ -115,6 +115,18 @@ public:
     return std::invoke(func_ptr_, obj, std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
+  /** Execute the wrapped method, moving the arguments that it takes by value.
+   * It's available if the method takes an argument of a class type by value.
+   * @param obj Reference to instance the method should operate on.
+   * @param a Arguments to be passed on to the method.
+   * @return The return value of the method invocation.
+   */
+  template<bool T_moves = (std::is_class_v<T_arg> || ...), typename = std::enable_if_t<T_moves>>
+  decltype(auto) operator()(obj_type_with_modifier& obj, type_trait_take_moving_t<T_arg>... a) const
+  {
+    return std::invoke(func_ptr_, obj, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+  }
+
 protected:
   function_type func_ptr_;
 };
@@ -152,6 +164,18 @@ public:
       this->func_ptr_, obj_.invoke(), std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
+  /** Execute the wrapped method, moving the arguments that it takes by value.
+   * It's available if the method takes an argument of a class type by value.
+   * @param a Arguments to be passed on to the method.
+   * @return The return value of the method invocation.
+   */
+  template<bool T_moves = (std::is_class_v<T_arg> || ...), typename = std::enable_if_t<T_moves>>
+  decltype(auto) operator()(type_trait_take_moving_t<T_arg>... a) const
+  {
+    return std::invoke(
+      this->func_ptr_, obj_.invoke(), std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+  }
+
   // protected:
   // Reference to stored object instance.
   // This is the handler object, such as TheObject in void TheObject::signal_handler().
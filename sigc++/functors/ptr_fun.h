@@ -97,6 +97,18 @@ public:
   {
     return std::invoke(func_ptr_, std::forward<type_trait_take_t<T_args>>(a)...);
   }
+
+  /** Execute the wrapped function, moving the arguments that it takes by value.
+   * It's available if the function takes an argument of a class type by value.
+   * @param a Arguments to be passed on to the function.
+   * @return The return value of the function invocation.
+   */
+  template<bool T_moves = (std::is_class_v<T_args> || ...),
+    typename = std::enable_if_t<T_moves>>
+  T_return operator()(type_trait_take_moving_t<T_args>... a) const
+  {
+    return std::invoke(func_ptr_, std::forward<type_trait_take_moving_t<T_args>>(a)...);
+  }
 };
 
 /** Creates a functor of type sigc::pointer_functor which wraps an existing non-member function.
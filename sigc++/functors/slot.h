@@ -25,10 +25,161 @@
 #include <sigc++/functors/slot_base.h>
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <type_traits>
 
 namespace sigc
 {
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename T_functor, typename... T_obj>
+class track_obj_functor;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+namespace internal
+{
+
+template<typename T>
+struct is_const_member_function : public std::false_type
+{
+};
+
+template<typename T_return, typename T_obj, typename... T_arg>
+struct is_const_member_function<T_return (T_obj::*)(T_arg...) const> : public std::true_type
+{
+};
+
+template<typename T_return, typename T_obj, typename... T_arg>
+struct is_const_member_function<T_return (T_obj::*)(T_arg...) const noexcept>
+: public std::true_type
+{
+};
+
+/** Whether @e T_functor has exactly one operator()(), which is const and not a template.
+ * That's true for lambda expressions without the @p mutable keyword,
+ * but not for generic lambda expressions.
+ */
+template<typename T_functor, typename = void>
+struct has_const_call_operator : public std::false_type
+{
+};
+
+template<typename T_functor>
+struct has_const_call_operator<T_functor, std::void_t<decltype(&T_functor::operator())>>
+: public is_const_member_function<decltype(&T_functor::operator())>
+{
+};
+
+template<typename T>
+struct function_pointer_of
+{
+  using type = void;
+};
+
+template<typename T_return, typename T_obj, typename... T_arg>
+struct function_pointer_of<T_return (T_obj::*)(T_arg...) const>
+{
+  using type = T_return (*)(T_arg...);
+};
+
+template<typename T_return, typename T_obj, typename... T_arg>
+struct function_pointer_of<T_return (T_obj::*)(T_arg...) const noexcept>
+{
+  using type = T_return (*)(T_arg...);
+};
+
+/** Whether @e T_functor looks like the closure type of a lambda expression
+ * without the @p mutable keyword. See sigc::slot_rep_sharing.
+ */
+template<typename T_functor, bool I_callable = has_const_call_operator<T_functor>::value>
+struct is_immutable_lambda : public std::false_type
+{
+};
+
+template<typename T_functor>
+struct is_immutable_lambda<T_functor, true>
+: public std::bool_constant<std::is_convertible_v<T_functor,
+                              typename function_pointer_of<decltype(&T_functor::operator())>::type> ||
+                            (!std::is_aggregate_v<T_functor> &&
+                              !std::is_default_constructible_v<T_functor> &&
+                              !std::is_copy_assignable_v<T_functor>)>
+{
+};
+
+} /* namespace internal */
+
+/** Trait that lets copies of a slot with a functor of type @e T_functor share their internal data.
+ * Copying a slot normally copies its functor. If the functor is immutable,
+ * the copies of a slot that is not connected to a signal instead share one
+ * reference-counted copy of the functor. A copy gets its own copy of the
+ * functor when it's connected, disconnected or handed to a sigc::connection,
+ * see slot_base::unshare().
+ *
+ * Sharing saves the copies of slots that are stored, passed around and
+ * returned. It does not save the copy that signal::connect() makes: a
+ * connected slot keeps per-connection state in its internal data, so
+ * connecting a slot still copies the functor.
+ *
+ * By default the functor is shared if it's a pointer to a function or a
+ * member, one of the functors that sigc::mem_fun() and sigc::ptr_fun()
+ * return, or a lambda expression without the @p mutable keyword.
+ * sigc::track_obj() keeps the functor's setting. Lambda expressions are
+ * recognized by properties of their closure types, since the language
+ * offers no way to tell them from other classes: a lambda expression
+ * without captures converts to a pointer to a function, and the closure
+ * type of one with captures is neither an aggregate, nor default
+ * constructible, nor copy assignable. A lambda expression that captures a
+ * functor whose const operator()() modifies its own state, e.g. a
+ * @p mutable member, shares that state between the copies of the slot.
+ *
+ * Other class types, such as std::function, sigc::slot and user-defined
+ * functors, are not shared by default. Specialize the trait for a functor
+ * type whose operator()() is const and doesn't modify the functor:
+ * @code
+ * template<>
+ * struct sigc::slot_rep_sharing<Formatter> : std::true_type
+ * {
+ * };
+ * @endcode
+ * Functors that can't be copied are never shared.
+ *
+ * @ingroup slot
+ */
+template<typename T_functor>
+struct slot_rep_sharing
+: public std::bool_constant<std::is_pointer_v<T_functor> ||
+                            std::is_member_pointer_v<T_functor> ||
+                            internal::is_immutable_lambda<T_functor>::value>
+{
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+// The functors from sigc::ptr_fun() and sigc::mem_fun() have overloaded operator()()s.
+template<typename T_return, typename... T_arg>
+struct slot_rep_sharing<pointer_functor<T_return(T_arg...)>> : public std::true_type
+{
+};
+
+template<typename T_func, typename... T_arg>
+struct slot_rep_sharing<mem_functor<T_func, T_arg...>> : public std::true_type
+{
+};
+
+template<typename T_func, typename... T_arg>
+struct slot_rep_sharing<bound_mem_functor<T_func, T_arg...>> : public std::true_type
+{
+};
+
+// sigc::track_obj() doesn't change the mutability of the functor.
+template<typename T_functor, typename... T_obj>
+struct slot_rep_sharing<track_obj_functor<T_functor, T_obj...>>
+: public slot_rep_sharing<T_functor>
+{
+};
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 namespace internal
 {
 
@@ -61,6 +212,17 @@ function_pointer_cast(T_in in)
  * targets that inherit trackable recursively and register the
  * notification callback. Consequently the slot_rep object will be
  * notified when some referred object is destroyed or overwritten.
+ *
+ * The functor is stored inside the typed_slot_rep object. Since
+ * typed_slot_rep is instantiated for each functor type, the slot_rep and its
+ * functor are allocated together, and slot_call::call_it() reaches the
+ * functor without dereferencing another pointer.
+ *
+ * Most functors, such as lambda expressions and function pointers, have no
+ * trackable targets (see has_trackable_targets). Then the slot_rep can't be
+ * invalidated by a trackable, and destroy() is called only by the destructor.
+ * Such a typed_slot_rep holds the functor directly instead of in a
+ * std::optional, and does not visit the functor at all.
  */
 template<typename T_functor>
 struct typed_slot_rep : public slot_rep
@@ -70,24 +232,106 @@ private:
    * through explicit template instantiation from slot_call#::call_it() */
   using adaptor_type = typename adaptor_trait<T_functor>::adaptor_type;
 
+  static constexpr bool tracks_targets = has_trackable_targets<T_functor>::value;
+
+  // Holds a functor that is never destroyed before the slot_rep.
+  struct untracked_functor
+  {
+    template<typename T_src>
+    inline untracked_functor(std::in_place_t, T_src&& src) : functor_(std::forward<T_src>(src))
+    {
+    }
+
+    inline adaptor_type& operator*() noexcept { return functor_; }
+    inline const adaptor_type& operator*() const noexcept { return functor_; }
+
+    adaptor_type functor_;
+  };
+
 public:
-  /** The functor contained by this slot_rep object. */
-  std::unique_ptr<adaptor_type> functor_;
+  /** The functor contained by this slot_rep object.
+   * If the functor may have trackable targets, it's empty after destroy()
+   * has been called.
+   */
+  std::conditional_t<tracks_targets, std::optional<adaptor_type>, untracked_functor> functor_;
+
+  /** Whether the functor can be copied.
+   * If it can't, clone() throws std::logic_error.
+   */
+  static constexpr bool is_copyable = std::is_copy_constructible_v<adaptor_type>;
+
+  /** Whether copies of a slot may share this slot_rep.
+   * See sigc::slot_rep_sharing.
+   */
+  static constexpr bool is_shareable = slot_rep_sharing<T_functor>::value && is_copyable;
 
   /** Constructs an invalid typed slot_rep object.
    * The notification callback is registered using visit_each().
    * @param functor The functor contained by the new slot_rep object.
    */
   inline explicit typed_slot_rep(const T_functor& functor)
-  : slot_rep(nullptr), functor_(std::make_unique<adaptor_type>(functor))
+  : slot_rep(nullptr), functor_(std::in_place, functor)
+  {
+    init();
+  }
+
+  inline explicit typed_slot_rep(T_functor&& functor)
+  : slot_rep(nullptr), functor_(std::in_place, std::move(functor))
   {
-    sigc::visit_each_trackable(slot_do_bind(this), *functor_);
+    init();
   }
 
   inline typed_slot_rep(const typed_slot_rep& src)
-  : slot_rep(src.call_), functor_(std::make_unique<adaptor_type>(*src.functor_))
+  : slot_rep(src.call_), functor_(std::in_place, *src.functor_)
+  {
+    move_call_ = src.move_call_;
+    init();
+  }
+
+  /** Constructs an invalid typed slot_rep object that allocates from @a resource.
+   * @param resource The memory resource of the callback list.
+   * @param functor The functor contained by the new slot_rep object.
+   */
+  inline typed_slot_rep(std::pmr::memory_resource* resource, const T_functor& functor)
+  : slot_rep(nullptr, resource), functor_(std::in_place, functor)
+  {
+    init();
+  }
+
+  inline typed_slot_rep(std::pmr::memory_resource* resource, T_functor&& functor)
+  : slot_rep(nullptr, resource), functor_(std::in_place, std::move(functor))
   {
-    sigc::visit_each_trackable(slot_do_bind(this), *functor_);
+    init();
+  }
+
+  inline typed_slot_rep(std::pmr::memory_resource* resource, const typed_slot_rep& src)
+  : slot_rep(src.call_, resource), functor_(std::in_place, *src.functor_)
+  {
+    move_call_ = src.move_call_;
+    init();
+  }
+
+  /** Constructs an invalid typed slot_rep object with a callback list owned by a derived class.
+   * @param list The callback list.
+   * @param functor The functor contained by the new slot_rep object.
+   */
+  inline typed_slot_rep(trackable_callback_list* list, const T_functor& functor)
+  : slot_rep(nullptr, list), functor_(std::in_place, functor)
+  {
+    init();
+  }
+
+  inline typed_slot_rep(trackable_callback_list* list, T_functor&& functor)
+  : slot_rep(nullptr, list), functor_(std::in_place, std::move(functor))
+  {
+    init();
+  }
+
+  inline typed_slot_rep(trackable_callback_list* list, const typed_slot_rep& src)
+  : slot_rep(src.call_, list), functor_(std::in_place, *src.functor_)
+  {
+    move_call_ = src.move_call_;
+    init();
   }
 
   typed_slot_rep& operator=(const typed_slot_rep& src) = delete;
@@ -103,16 +347,30 @@ public:
   }
 
 private:
+  /** Registers the notification callback in the referred trackables,
+   * and lets copies of the slot share the slot_rep, if the functor is immutable.
+   */
+  inline void init()
+  {
+    if constexpr (is_shareable)
+      enable_sharing();
+    if constexpr (tracks_targets)
+      sigc::visit_each_trackable(slot_do_bind(this), *functor_);
+  }
+
   /** Detaches the stored functor from the other referred trackables and destroys it.
    * This does not destroy the base slot_rep object.
    */
   void destroy() override
   {
     call_ = nullptr;
-    if (functor_)
+    if constexpr (tracks_targets)
     {
-      sigc::visit_each_trackable(slot_do_unbind(this), *functor_);
-      functor_.reset(nullptr);
+      if (functor_)
+      {
+        sigc::visit_each_trackable(slot_do_unbind(this), *functor_);
+        functor_.reset();
+      }
     }
     /* don't call disconnect() here: destroy() is either called
      * a) from the parent itself (in which case disconnect() leads to a segfault) or
@@ -125,13 +383,217 @@ private:
    * slot_rep object is registered in the referred trackables.
    * @return A deep copy of the slot_rep object.
    */
-  slot_rep* clone() const override { return new typed_slot_rep(*this); }
+  slot_rep* clone() const override
+  {
+    if constexpr (is_copyable)
+      return new typed_slot_rep(*this);
+    else
+      throw_functor_not_copyable();
+  }
+
+  slot_rep* clone_in(std::pmr::memory_resource* resource) const override;
+};
+
+/** A typed_slot_rep that has been allocated from a std::pmr::memory_resource.
+ * Its copies are allocated from the same resource.
+ */
+template<typename T_functor>
+struct pmr_slot_rep final : public typed_slot_rep<T_functor>
+{
+  template<typename T_src>
+  inline pmr_slot_rep(std::pmr::memory_resource* resource, T_src&& src)
+  : typed_slot_rep<T_functor>(resource, std::forward<T_src>(src)), resource_(resource)
+  {
+  }
+
+  /** Creates a pmr_slot_rep in memory from @a resource.
+   * @param resource The memory resource. It must outlive the slot_rep.
+   * @param src The functor, or the typed_slot_rep to copy.
+   * @return The new slot_rep. It must be deleted with release().
+   */
+  template<typename T_src>
+  static pmr_slot_rep* create(std::pmr::memory_resource* resource, T_src&& src)
+  {
+    auto p = resource->allocate(sizeof(pmr_slot_rep), alignof(pmr_slot_rep));
+    try
+    {
+      return new (p) pmr_slot_rep(resource, std::forward<T_src>(src));
+    }
+    catch (...)
+    {
+      resource->deallocate(p, sizeof(pmr_slot_rep), alignof(pmr_slot_rep));
+      throw;
+    }
+  }
+
+  std::pmr::memory_resource* resource() const noexcept override { return resource_; }
+
+  void release() noexcept override
+  {
+    const auto resource = resource_;
+    this->~pmr_slot_rep();
+    resource->deallocate(this, sizeof(pmr_slot_rep), alignof(pmr_slot_rep));
+  }
+
+private:
+  slot_rep* clone() const override
+  {
+    if constexpr (typed_slot_rep<T_functor>::is_copyable)
+      return create(resource_, static_cast<const typed_slot_rep<T_functor>&>(*this));
+    else
+      throw_functor_not_copyable();
+  }
+
+  std::pmr::memory_resource* const resource_;
+};
+
+/** Thread-local cache of memory blocks for objects of type @e T.
+ * Blocks that are deallocated are kept for the next allocate() call of the
+ * same thread, up to a limit. The cache is emptied when the thread exits.
+ */
+template<typename T>
+class freelist
+{
+public:
+  static void* allocate()
+  {
+    auto& c = cache_;
+    if (const auto b = c.head_)
+    {
+      c.head_ = b->next_;
+      --c.size_;
+      return b;
+    }
+    return ::operator new(sizeof(T));
+  }
+
+  static void deallocate(void* p) noexcept
+  {
+    auto& c = cache_;
+    if (c.closed_ || c.size_ == max_size)
+    {
+      ::operator delete(p);
+      return;
+    }
+
+    // Constructs the cleaner in the first call of this thread.
+    static thread_local cleaner cleaner_;
+    (void)cleaner_;
+
+    const auto b = static_cast<block*>(p);
+    b->next_ = c.head_;
+    c.head_ = b;
+    ++c.size_;
+  }
+
+private:
+  struct block
+  {
+    block* next_;
+  };
+
+  static_assert(sizeof(T) >= sizeof(block), "A block must fit into the memory of a T.");
+
+  static constexpr std::size_t max_size = 256;
+
+  // Trivially destructible, so that it can be used while other thread-local objects are destroyed.
+  struct cache_type
+  {
+    block* head_;
+    std::size_t size_;
+    bool closed_;
+  };
+
+  struct cleaner
+  {
+    ~cleaner()
+    {
+      auto& c = cache_;
+      c.closed_ = true;
+      while (const auto b = c.head_)
+      {
+        c.head_ = b->next_;
+        ::operator delete(b);
+      }
+      c.size_ = 0;
+    }
+  };
+
+  static inline thread_local cache_type cache_{ nullptr, 0, false };
+};
+
+/** A typed_slot_rep whose memory is recycled by a freelist of its type.
+ * It's used instead of typed_slot_rep, if sigc::slot_rep_pooling<T_functor>
+ * is true. Its trackable callback list is stored inline, like the one of a
+ * sigc::inline_trackable, so a connect/disconnect cycle doesn't allocate
+ * memory in the steady state.
+ */
+template<typename T_functor>
+struct pooled_slot_rep final
+: private inline_callback_list<1>,
+  public typed_slot_rep<T_functor>
+{
+  inline explicit pooled_slot_rep(const T_functor& functor)
+  : typed_slot_rep<T_functor>(&this->list_, functor)
+  {
+  }
+
+  inline explicit pooled_slot_rep(T_functor&& functor)
+  : typed_slot_rep<T_functor>(&this->list_, std::move(functor))
+  {
+  }
+
+  inline pooled_slot_rep(const pooled_slot_rep& src)
+  : inline_callback_list<1>(), typed_slot_rep<T_functor>(&this->list_, src)
+  {
+  }
+
+  ~pooled_slot_rep() override
+  {
+    this->notify_callbacks();
+    this->release_callback_list();
+  }
+
+  static void* operator new(std::size_t /* size */)
+  {
+    return freelist<pooled_slot_rep>::allocate();
+  }
+  static void operator delete(void* p) { freelist<pooled_slot_rep>::deallocate(p); }
+
+private:
+  slot_rep* clone() const override
+  {
+    if constexpr (typed_slot_rep<T_functor>::is_copyable)
+      return new pooled_slot_rep(*this);
+    else
+      throw_functor_not_copyable();
+  }
 };
 
+template<typename T_functor>
+slot_rep*
+typed_slot_rep<T_functor>::clone_in(std::pmr::memory_resource* resource) const
+{
+  if constexpr (is_copyable)
+  {
+    if (!resource)
+      return new typed_slot_rep(*this);
+
+    return pmr_slot_rep<T_functor>::create(resource, *this);
+  }
+  else
+  {
+    static_cast<void>(resource);
+    throw_functor_not_copyable();
+  }
+}
+
 /** Abstracts functor execution.
  * call_it() invokes a functor of type @e T_functor with a list of
  * parameters whose types are given by the template arguments.
  * address() forms a function pointer from call_it().
+ * call_it_moving() and move_address() do the same, but move the
+ * arguments that are passed by value.
  *
  * The following template arguments are used:
  * - @e T_functor The functor type.
@@ -159,10 +621,82 @@ struct slot_call
    * @return A function pointer formed from call_it().
    */
   static hook address() { return sigc::internal::function_pointer_cast<hook>(&call_it); }
+
+  /** Invokes a functor of type @p T_functor, moving the arguments that are passed by value.
+   * @param rep slot_rep object that holds a functor of type @p T_functor.
+   * @param a Arguments to be passed on to the functor.
+   * @return The return values of the functor invocation.
+   */
+  static T_return call_it_moving(slot_rep* rep, type_trait_take_moving_t<T_arg>... a_)
+  {
+    auto typed_rep = static_cast<typed_slot_rep<T_functor>*>(rep);
+    return (*typed_rep->functor_)
+      .template operator()<type_trait_take_moving_t<T_arg>...>(
+        std::forward<type_trait_take_moving_t<T_arg>>(a_)...);
+  }
+
+  /** Forms a function pointer from call_it_moving().
+   * Adaptors, such as the functors that sigc::bind() and sigc::hide() return,
+   * get @p nullptr. Their operator()()s deduce their return types, so whether
+   * they accept rvalues can't be checked without instantiating them, which
+   * may fail to compile.
+   * @return A function pointer formed from call_it_moving(), or from call_it()
+   *         if no argument is moved, or @p nullptr if the functor can't take
+   *         the moved arguments, e.g. if it takes them by non-const reference.
+   */
+  static hook move_address()
+  {
+    if constexpr (!(std::is_class_v<T_arg> || ...))
+      return address();
+    else if constexpr (!std::is_base_of_v<adaptor_base, T_functor> &&
+                       std::is_invocable_v<T_functor&, type_trait_take_moving_t<T_arg>...>)
+      return sigc::internal::function_pointer_cast<hook>(&call_it_moving);
+    else
+      return nullptr;
+  }
 };
 
 } /* namespace internal */
 
+/** Trait that enables the recycling of the memory of slots with functors of type @e T_functor.
+ * Specialize it for functor types that are connected and disconnected often:
+ * @code
+ * template<>
+ * struct sigc::slot_rep_pooling<sigc::bound_mem_functor<void (Receiver::*)(int), int>>
+ * : std::true_type
+ * {
+ * };
+ * @endcode
+ * A sigc::slot that's constructed from such a functor keeps its internal data
+ * in a memory block that's recycled through a thread-local cache when the slot
+ * is destroyed. In the steady state, a connect/disconnect cycle then doesn't
+ * allocate memory at all. Each thread caches up to 256 blocks per functor type.
+ *
+ * The specialization must be visible wherever a slot is constructed from the functor.
+ *
+ * @ingroup slot
+ */
+template<typename T_functor>
+struct slot_rep_pooling : public std::false_type
+{
+};
+
+namespace internal
+{
+
+/// Creates the slot_rep of a slot, taking slot_rep_pooling into account.
+template<typename T_functor, typename T_src>
+inline slot_rep*
+new_slot_rep(T_src&& func)
+{
+  if constexpr (slot_rep_pooling<T_functor>::value)
+    return new pooled_slot_rep<T_functor>(std::forward<T_src>(func));
+  else
+    return new typed_slot_rep<T_functor>(std::forward<T_src>(func));
+}
+
+} /* namespace internal */
+
 // Because slot is opaque, visit_each() will not visit its internal members.
 // Those members are not reachable by visit_each() after the slot has been
 // constructed. But when a slot contains another slot, the outer slot will become
@@ -190,6 +724,10 @@ struct slot_call
  * block() and unblock() can be used to block the functor's invocation
  * from operator()() temporarily.
  *
+ * Copies of a slot share an immutable functor, such as a lambda expression
+ * without the @p mutable keyword, until a copy is connected to a signal or
+ * disconnected. See sigc::slot_rep_sharing.
+ *
  * @ingroup slot
  */
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -209,8 +747,15 @@ public:
 private:
   using rep_type = internal::slot_rep;
 
+  // Whether slot(T_functor&&) moves an argument of type T_functor&&.
+  // Other slots are copied and become the parents of the copies, as before.
+  template<typename T_functor>
+  static constexpr bool is_movable_functor_v = std::is_same_v<T_functor, std::decay_t<T_functor>> &&
+                                               !std::is_base_of_v<slot_base, T_functor>;
+
 public:
   using call_type = T_return (*)(rep_type*, type_trait_take_t<T_arg>...);
+  using move_call_type = T_return (*)(rep_type*, type_trait_take_moving_t<T_arg>...);
 #endif
 
   /** Invoke the contained functor unless slot is in blocking state.
@@ -241,10 +786,56 @@ public:
    * @param func The desired functor the new slot should be assigned to.
    */
   template<typename T_functor>
-  slot(const T_functor& func) : slot_base(new internal::typed_slot_rep<T_functor>(func))
+  slot(const T_functor& func) : slot_base(internal::new_slot_rep<T_functor>(func))
   {
     // The slot_base:: is necessary to stop the HP-UX aCC compiler from being confused. murrayc.
     slot_base::rep_->call_ = internal::slot_call<T_functor, T_return, T_arg...>::address();
+    slot_base::rep_->move_call_ =
+      internal::slot_call<T_functor, T_return, T_arg...>::move_address();
+  }
+
+  /** Constructs a slot from an arbitrary functor, moving it.
+   * The functor may be move-only. A slot with a move-only functor can be
+   * moved, and connected to a signal with signal::connect(slot_type&&), but
+   * copying it throws std::logic_error.
+   * @param func The desired functor the new slot should be assigned to.
+   */
+  template<typename T_functor, typename = std::enable_if_t<is_movable_functor_v<T_functor>>>
+  slot(T_functor&& func) : slot_base(internal::new_slot_rep<T_functor>(std::move(func)))
+  {
+    slot_base::rep_->call_ = internal::slot_call<T_functor, T_return, T_arg...>::address();
+    slot_base::rep_->move_call_ =
+      internal::slot_call<T_functor, T_return, T_arg...>::move_address();
+  }
+
+  /** Constructs a slot from an arbitrary functor, in memory from a std::pmr::memory_resource.
+   * The functor is stored in the slot's internal representation, which is
+   * allocated from @a resource, like its copies.
+   * @param resource The memory resource. It must outlive the slot and its copies.
+   * @param func The desired functor the new slot should be assigned to.
+   */
+  template<typename T_functor>
+  slot(std::allocator_arg_t, std::pmr::memory_resource* resource, const T_functor& func)
+  : slot_base(internal::pmr_slot_rep<T_functor>::create(resource, func))
+  {
+    slot_base::rep_->call_ = internal::slot_call<T_functor, T_return, T_arg...>::address();
+    slot_base::rep_->move_call_ =
+      internal::slot_call<T_functor, T_return, T_arg...>::move_address();
+  }
+
+  /** Constructs a slot from an arbitrary functor, moving it into memory from a
+   * std::pmr::memory_resource.
+   * @see slot(T_functor&& func).
+   * @param resource The memory resource. It must outlive the slot and its copies.
+   * @param func The desired functor the new slot should be assigned to.
+   */
+  template<typename T_functor, typename = std::enable_if_t<is_movable_functor_v<T_functor>>>
+  slot(std::allocator_arg_t, std::pmr::memory_resource* resource, T_functor&& func)
+  : slot_base(internal::pmr_slot_rep<T_functor>::create(resource, std::move(func)))
+  {
+    slot_base::rep_->call_ = internal::slot_call<T_functor, T_return, T_arg...>::address();
+    slot_base::rep_->move_call_ =
+      internal::slot_call<T_functor, T_return, T_arg...>::move_address();
   }
 
   /** Constructs a slot, copying an existing one.
@@ -306,8 +897,12 @@ struct visitor<slot<T_return, T_arg...>>
     const slot<T_return, T_arg...>& target)
   {
     if (target.rep_ && target.rep_->parent_ == nullptr)
+    {
+      // The inner slot may share its slot_rep with slots outside the outer slot.
+      target.unshare();
       target.rep_->set_parent(
         action.action_.rep_, &internal::slot_rep::notify_slot_rep_invalidated);
+    }
   }
 
   static void do_visit_each(
@@ -19,10 +19,15 @@
 
 #include <sigc++/functors/slot_base.h>
 #include <sigc++/weak_raw_ptr.h>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
 
 namespace
 {
-// Used by slot_base::set_parent() when a slot_base without a rep_ is assigned a parent.
+// Used by slot_base::set_parent() when a slot_base without a rep_ is assigned a parent,
+// and by slot_base::disconnect() when a slot_base shares its rep_ with other slots.
 class dummy_slot_rep : public sigc::internal::slot_rep
 {
 public:
@@ -30,6 +35,246 @@ public:
   sigc::internal::slot_rep* clone() const override { return new dummy_slot_rep(); }
   void destroy() override {}
 };
+
+// Removes a slot's reference to a slot_rep that it may share with other slots.
+void
+release_rep(sigc::internal::slot_rep* rep) noexcept
+{
+  if (rep->unreference())
+    rep->release();
+}
+
+// Returns the slot_rep of a copy of a slot: rep itself if it can be shared.
+sigc::internal::slot_rep*
+share_or_clone(sigc::internal::slot_rep* rep)
+{
+  if (rep->shareable())
+  {
+    rep->reference();
+    return rep;
+  }
+  return rep->clone();
+}
+
+// The entries of sigc::internal::slot_handle_table.
+// The fields are atomic, because a stale handle can be looked up in one thread
+// while the entry is reused in another one.
+struct slot_handle_entry
+{
+  std::atomic<sigc::slot_base*> slot_;
+  std::atomic<std::uint32_t> generation_;
+  // The next entry in the free list of the segment.
+  std::atomic<std::uint32_t> next_free_;
+};
+
+// Segment k holds first_segment_size << k entries, so 27 segments
+// are enough for all indices that fit into a std::uint32_t.
+constexpr std::uint64_t first_segment_size = 64;
+constexpr std::size_t n_segments = 27;
+
+// An entry whose generation reaches this value is not reused, so that its
+// generation never wraps around to the one of a stale handle.
+constexpr std::uint32_t retired_generation = static_cast<std::uint32_t>(-1);
+
+// Marks the end of a free list.
+constexpr std::uint32_t no_entry = static_cast<std::uint32_t>(-1);
+
+// Set in handle_segment::users_ while the segment is allocated and may be pinned.
+constexpr std::uint64_t segment_open = std::uint64_t(1) << 63;
+
+// A segment of the table. Segment 0 is static. The others are allocated when
+// all allocated segments are full, and freed again when they are empty.
+struct handle_segment
+{
+  std::atomic<slot_handle_entry*> entries_;
+
+  // segment_open, plus one pin per acquired entry and per running lookup.
+  // A segment is freed only by the thread that clears segment_open while
+  // there are no pins, so a pinned segment stays allocated.
+  std::atomic<std::uint64_t> users_;
+
+  // The number of acquired entries.
+  std::atomic<std::uint64_t> live_;
+
+  // The head of the free list: a tag in the upper half, against the ABA
+  // problem, and the offset of the first released entry in the lower half.
+  std::atomic<std::uint64_t> free_head_;
+
+  // The number of entries that have been handed out since the segment was allocated.
+  std::atomic<std::uint32_t> fresh_;
+
+  // The generation of the entries when the segment is allocated again.
+  // It's greater than the generations of all handles into the freed segment.
+  std::uint32_t generation_floor_;
+};
+
+slot_handle_entry first_handle_segment[first_segment_size];
+handle_segment handle_segments[n_segments] = { { first_handle_segment, segment_open, 0,
+  no_entry, 0, 0 } };
+
+constexpr std::uint64_t
+segment_size(std::size_t k) noexcept
+{
+  return first_segment_size << k;
+}
+
+// Returns the segment of the entry at index i - first_segment_size.
+std::size_t
+segment_of(std::uint64_t i) noexcept
+{
+  std::size_t k = 0;
+  while (i >> (k + 1) >= first_segment_size)
+    ++k;
+  return k;
+}
+
+// Splits an index into a segment and an offset in the segment.
+std::pair<std::size_t, std::uint32_t>
+locate(std::uint32_t index) noexcept
+{
+  const std::uint64_t i = index + first_segment_size;
+  const auto k = segment_of(i);
+  return { k, static_cast<std::uint32_t>(i - segment_size(k)) };
+}
+
+std::uint32_t
+index_of(std::size_t k, std::uint32_t offset) noexcept
+{
+  return static_cast<std::uint32_t>(segment_size(k) - first_segment_size + offset);
+}
+
+// The number of entries of segment k. Only the last segment is cut short,
+// so that no index equals slot_handle::invalid_index.
+std::uint64_t
+segment_capacity(std::size_t k) noexcept
+{
+  return std::min<std::uint64_t>(segment_size(k),
+    std::uint64_t(sigc::internal::slot_handle::invalid_index) -
+      (segment_size(k) - first_segment_size));
+}
+
+// Keeps segment k allocated until unpin() is called. The static segment
+// needs no pin.
+bool
+pin(std::size_t k) noexcept
+{
+  if (k == 0)
+    return true;
+
+  auto& s = handle_segments[k];
+  if (s.users_.fetch_add(1, std::memory_order_acquire) & segment_open)
+    return true;
+  s.users_.fetch_sub(1, std::memory_order_relaxed);
+  return false;
+}
+
+void
+unpin(std::size_t k) noexcept
+{
+  if (k != 0)
+    handle_segments[k].users_.fetch_sub(1, std::memory_order_release);
+}
+
+// Takes an entry of the pinned segment k: a released one, or one that has never been used.
+std::uint32_t
+pop_entry(std::size_t k) noexcept
+{
+  auto& s = handle_segments[k];
+  const auto entries = s.entries_.load(std::memory_order_acquire);
+
+  auto head = s.free_head_.load(std::memory_order_acquire);
+  while (static_cast<std::uint32_t>(head) != no_entry)
+  {
+    const auto offset = static_cast<std::uint32_t>(head);
+    const std::uint64_t next = entries[offset].next_free_.load(std::memory_order_relaxed);
+    const auto tag = (head >> 32) + 1;
+    if (s.free_head_.compare_exchange_weak(
+          head, (tag << 32) | next, std::memory_order_acquire, std::memory_order_acquire))
+      return offset;
+  }
+
+  auto fresh = s.fresh_.load(std::memory_order_relaxed);
+  while (fresh < segment_capacity(k))
+  {
+    if (s.fresh_.compare_exchange_weak(fresh, fresh + 1, std::memory_order_relaxed))
+      return fresh;
+  }
+  return no_entry;
+}
+
+// Puts a released entry of the pinned segment k on its free list.
+void
+push_entry(std::size_t k, std::uint32_t offset) noexcept
+{
+  auto& s = handle_segments[k];
+  auto& e = s.entries_.load(std::memory_order_relaxed)[offset];
+
+  auto head = s.free_head_.load(std::memory_order_relaxed);
+  do
+  {
+    e.next_free_.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+  } while (!s.free_head_.compare_exchange_weak(head,
+    (((head >> 32) + 1) << 32) | offset, std::memory_order_release, std::memory_order_relaxed));
+}
+
+// Allocates segment k, unless it's allocated already, or still being freed.
+void
+allocate_segment(std::size_t k)
+{
+  auto& s = handle_segments[k];
+  const auto entries = new slot_handle_entry[segment_capacity(k)]();
+
+  slot_handle_entry* expected = nullptr;
+  if (!s.entries_.compare_exchange_strong(expected, entries, std::memory_order_acq_rel))
+  {
+    delete[] entries;
+    return;
+  }
+
+  // The segment can't be pinned yet, so it's not shared with other threads.
+  for (std::uint64_t i = 0; i < segment_capacity(k); ++i)
+    entries[i].generation_.store(s.generation_floor_, std::memory_order_relaxed);
+  s.free_head_.store(no_entry, std::memory_order_relaxed);
+  s.fresh_.store(0, std::memory_order_relaxed);
+  s.users_.fetch_add(segment_open, std::memory_order_release);
+}
+
+// Frees segment k, and the segments above it, while they are empty.
+// A segment is kept while the one below it is more than half full,
+// so that connecting and disconnecting at the border of two segments
+// doesn't allocate and free a segment each time.
+void
+reclaim_segments(std::size_t k) noexcept
+{
+  for (; k < n_segments; ++k)
+  {
+    auto& s = handle_segments[k];
+    if (s.live_.load(std::memory_order_relaxed) != 0 ||
+        handle_segments[k - 1].live_.load(std::memory_order_relaxed) > segment_size(k - 1) / 2)
+      return;
+
+    auto expected = segment_open;
+    if (!s.users_.compare_exchange_strong(expected, 0, std::memory_order_acq_rel))
+      return; // It's in use, or not allocated.
+
+    // Nobody else can pin the segment now, and all of its entries are released.
+    const auto entries = s.entries_.load(std::memory_order_relaxed);
+    std::uint32_t floor = s.generation_floor_;
+    for (std::uint64_t i = 0; i < segment_capacity(k); ++i)
+      floor = std::max(floor, entries[i].generation_.load(std::memory_order_relaxed) + 1);
+
+    if (floor == retired_generation)
+    {
+      // The entries of a new segment would be retired at once. Keep this one.
+      s.users_.fetch_add(segment_open, std::memory_order_release);
+      return;
+    }
+
+    s.generation_floor_ = floor;
+    s.entries_.store(nullptr, std::memory_order_release);
+    delete[] entries;
+  }
+}
 } // anonymous namespace
 
 namespace sigc
@@ -51,6 +296,139 @@ slot_rep::operator delete(void* p)
 }
 #endif
 
+void
+throw_functor_not_copyable()
+{
+  throw std::logic_error("sigc::slot: a slot with a move-only functor can't be copied");
+}
+
+slot_rep*
+slot_rep::clone_in(std::pmr::memory_resource* /* resource */) const
+{
+  // Only typed_slot_rep supports memory resources.
+  return clone();
+}
+
+std::pmr::memory_resource*
+slot_rep::resource() const noexcept
+{
+  return nullptr;
+}
+
+void
+slot_rep::release() noexcept
+{
+  delete this;
+}
+
+// static
+slot_handle
+slot_handle_table::acquire(slot_base* slot)
+{
+  for (;;)
+  {
+    // Take an entry from the lowest segment that has one, so that the
+    // upper segments can become empty.
+    std::size_t unallocated = n_segments;
+    for (std::size_t k = 0; k < n_segments; ++k)
+    {
+      if (!pin(k))
+      {
+        if (unallocated == n_segments &&
+            !handle_segments[k].entries_.load(std::memory_order_relaxed))
+          unallocated = k;
+        continue;
+      }
+
+      const auto offset = pop_entry(k);
+      if (offset == no_entry)
+      {
+        unpin(k);
+        continue;
+      }
+
+      // The pin is kept until the entry is released.
+      auto& s = handle_segments[k];
+      s.live_.fetch_add(1, std::memory_order_relaxed);
+      auto& e = s.entries_.load(std::memory_order_relaxed)[offset];
+      e.slot_.store(slot, std::memory_order_release);
+      return { index_of(k, offset), e.generation_.load(std::memory_order_relaxed) };
+    }
+
+    // All allocated segments are full.
+    if (unallocated == n_segments)
+      throw std::length_error("sigc::internal::slot_handle_table is full");
+    allocate_segment(unallocated);
+  }
+}
+
+// static
+void
+slot_handle_table::release(std::uint32_t index) noexcept
+{
+  const auto [k, offset] = locate(index);
+  auto& s = handle_segments[k];
+  auto& e = s.entries_.load(std::memory_order_relaxed)[offset];
+
+  e.slot_.store(nullptr, std::memory_order_relaxed);
+  const auto generation = e.generation_.load(std::memory_order_relaxed) + 1;
+  e.generation_.store(generation, std::memory_order_release);
+  if (generation == retired_generation)
+    return; // The entry keeps its pin, so its segment is never freed.
+
+  push_entry(k, offset);
+  const auto live = s.live_.fetch_sub(1, std::memory_order_relaxed) - 1;
+  unpin(k);
+
+  if (k != 0 && live == 0)
+    reclaim_segments(k);
+  if (k + 1 < n_segments && live == segment_size(k) / 2)
+    reclaim_segments(k + 1);
+}
+
+// static
+std::uint32_t
+slot_handle_table::generation(std::uint32_t index) noexcept
+{
+  // The entry is acquired, so its segment is pinned.
+  const auto [k, offset] = locate(index);
+  return handle_segments[k].entries_.load(std::memory_order_relaxed)[offset].generation_.load(
+    std::memory_order_relaxed);
+}
+
+// static
+slot_base*
+slot_handle_table::lookup(slot_handle handle) noexcept
+{
+  if (handle.index_ == slot_handle::invalid_index)
+    return nullptr;
+
+  // A handle into a freed segment is stale.
+  const auto [k, offset] = locate(handle.index_);
+  if (!pin(k))
+    return nullptr;
+
+  // The slot is read first. If it's been stored after the entry was reused,
+  // the generation is already the new one.
+  const auto& e = handle_segments[k].entries_.load(std::memory_order_acquire)[offset];
+  const auto slot = e.slot_.load(std::memory_order_acquire);
+  const bool current = e.generation_.load(std::memory_order_relaxed) == handle.generation_;
+  unpin(k);
+  return current ? slot : nullptr;
+}
+
+slot_handle
+slot_rep::handle(slot_base* slot)
+{
+  if (handle_index_ == slot_handle::invalid_index)
+  {
+    const auto h = slot_handle_table::acquire(slot);
+    handle_index_ = h.index_;
+    return h;
+  }
+  return { handle_index_, slot_handle_table::generation(handle_index_) };
+}
+
 void
 slot_rep::disconnect()
 {
@@ -105,7 +483,7 @@ slot_base::slot_base(const slot_base& src) : rep_(nullptr), blocked_(src.blocked
     // invalidation) may be used during clone().
     // Note: I'd prefer to check somewhere during clone(). murrayc.
     if (src.rep_->call_)
-      rep_ = src.rep_->clone();
+      rep_ = share_or_clone(src.rep_);
     else
     {
       *this = slot_base(); // Return the default invalid slot.
@@ -133,7 +511,12 @@ slot_base::slot_base(slot_base&& src) : rep_(nullptr), blocked_(src.blocked_)
     else
     {
       // src is not connected. Really move src.rep_.
-      src.rep_->notify_callbacks();
+      // A shared slot_rep has neither destroy notify callbacks nor a handle.
+      if (!src.rep_->shared())
+      {
+        src.rep_->notify_callbacks();
+        src.rep_->release_handle();
+      }
       rep_ = src.rep_;
 
       // Wipe src:
@@ -145,7 +528,8 @@ slot_base::slot_base(slot_base&& src) : rep_(nullptr), blocked_(src.blocked_)
 
 slot_base::~slot_base()
 {
-  delete rep_;
+  if (rep_)
+    release_rep(rep_);
 }
 
 slot_base::operator bool() const noexcept
@@ -159,6 +543,14 @@ slot_base::delete_rep_with_check()
   if (!rep_)
     return;
 
+  if (rep_->shared())
+  {
+    // The other slots still refer to rep_, which has no parent to notify.
+    release_rep(rep_);
+    rep_ = nullptr;
+    return;
+  }
+
   // Make sure we are notified if disconnect() deletes rep_, which is trackable.
   // Compare slot_rep::notify_slot_rep_invalidated().
   sigc::internal::weak_raw_ptr<rep_type> notifier(rep_);
@@ -170,7 +562,7 @@ slot_base::delete_rep_with_check()
   // deletes rep_ to either clear the rep_ pointer or delete this slot_base.
   if (notifier)
   {
-    delete rep_; // Detach the stored functor from the other referred trackables and destroy it.
+    rep_->release(); // Detach the stored functor from the other referred trackables and destroy it.
     rep_ = nullptr;
   }
 }
@@ -191,12 +583,14 @@ slot_base::operator=(const slot_base& src)
     return *this;
   }
 
-  auto new_rep_ = src.rep_->clone();
+  // A slot with a parent shall not share its slot_rep.
+  auto new_rep_ = (rep_ && rep_->parent_) ? src.rep_->clone() : share_or_clone(src.rep_);
 
   if (rep_) // Silently exchange the slot_rep.
   {
-    new_rep_->set_parent(rep_->parent_, rep_->cleanup_);
-    delete rep_; // Calls destroy(), but does not call disconnect().
+    if (rep_->parent_)
+      new_rep_->set_parent(rep_->parent_, rep_->cleanup_);
+    release_rep(rep_); // Calls destroy(), but does not call disconnect().
   }
 
   rep_ = new_rep_;
@@ -231,36 +625,67 @@ slot_base::operator=(slot_base&& src)
   else
   {
     // src is not connected. Really move src.rep_.
-    src.rep_->notify_callbacks();
+    if (!src.rep_->shared())
+    {
+      src.rep_->notify_callbacks();
+      src.rep_->release_handle();
+    }
     new_rep_ = src.rep_;
 
     // Wipe src:
     src.rep_ = nullptr;
     src.blocked_ = false;
+
+    if (rep_ && rep_->parent_ && new_rep_->shared())
+    {
+      // A slot with a parent shall not share its slot_rep.
+      auto copy = new_rep_->clone();
+      release_rep(new_rep_);
+      new_rep_ = copy;
+    }
   }
 
   if (rep_) // Silently exchange the slot_rep.
   {
-    new_rep_->set_parent(rep_->parent_, rep_->cleanup_);
-    delete rep_; // Calls destroy(), but does not call disconnect().
+    if (rep_->parent_)
+      new_rep_->set_parent(rep_->parent_, rep_->cleanup_);
+    release_rep(rep_); // Calls destroy(), but does not call disconnect().
   }
   rep_ = new_rep_;
   return *this;
 }
 
 void
-slot_base::set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const noexcept
+slot_base::set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const
 {
   if (!rep_)
     rep_ = new dummy_slot_rep();
+  else
+    unshare();
   rep_->set_parent(parent, cleanup);
 }
 
 void
+slot_base::unshare() const
+{
+  if (rep_ && rep_->shared())
+  {
+    auto copy = rep_->clone();
+    release_rep(rep_);
+    rep_ = copy;
+  }
+}
+
+trackable::callback_handle
 slot_base::add_destroy_notify_callback(notifiable* data, func_destroy_notify func) const
 {
   if (rep_)
-    rep_->add_destroy_notify_callback(data, func);
+  {
+    // The callback shall be executed when this slot is destroyed.
+    unshare();
+    return rep_->add_destroy_notify_callback(data, func);
+  }
+  return internal::trackable_callback_list::invalid_handle;
 }
 
 void
@@ -270,6 +695,13 @@ slot_base::remove_destroy_notify_callback(notifiable* data) const
     rep_->remove_destroy_notify_callback(data);
 }
 
+void
+slot_base::remove_destroy_notify_callback(notifiable* data, trackable::callback_handle handle) const
+{
+  if (rep_)
+    rep_->remove_destroy_notify_callback(data, handle);
+}
+
 bool
 slot_base::block(bool should_block) noexcept
 {
@@ -287,8 +719,18 @@ slot_base::unblock() noexcept
 void
 slot_base::disconnect()
 {
-  if (rep_)
-    rep_->disconnect();
+  if (!rep_)
+    return;
+
+  if (rep_->shared())
+  {
+    // Don't invalidate the other slots. A shared slot_rep has no parent to notify.
+    auto invalid_rep = new dummy_slot_rep();
+    release_rep(rep_);
+    rep_ = invalid_rep;
+    return;
+  }
+  rep_->disconnect();
 }
 
 /*bool slot_base::empty() const // having this function not inline is killing performance !!!
@@ -21,15 +21,84 @@
 
 #include <sigc++config.h>
 #include <sigc++/trackable.h>
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
 
 namespace sigc
 {
 
+class slot_base;
+
 namespace internal
 {
 
+/** Handle of a slot in the slot_handle_table.
+ * It's a plain value. Copying it does not register anything anywhere.
+ */
+struct SIGC_API slot_handle
+{
+  /// An index that does not identify any entry.
+  static constexpr std::uint32_t invalid_index = static_cast<std::uint32_t>(-1);
+
+  /// The index of the entry in the slot_handle_table.
+  std::uint32_t index_;
+
+  /// The generation of the entry when the handle was issued.
+  std::uint32_t generation_;
+};
+
+/** Process-wide table of the slots that connections refer to.
+ * Each entry holds a pointer to a slot_base and a generation counter.
+ * An entry is acquired by a slot_rep when the first connection is made to
+ * its slot, and released when the slot_rep is deleted or moved to another
+ * slot_base. Releasing an entry increments its generation, so all handles
+ * that have been issued for it become stale at once. An entry whose
+ * generation is about to wrap around is retired instead of being reused,
+ * so a stale handle never matches again.
+ *
+ * The table is not owned by a signal, because a connection can outlive its
+ * signal, and can refer to a slot that's not in a signal at all.
+ *
+ * The entries are kept in segments that never move. The first one is static.
+ * The others are allocated when the table grows, and freed when they are
+ * empty again. None of the functions takes a lock. acquire() and release()
+ * use a lock-free free list per segment. lookup() is a constant-time check.
+ * They can be called from any thread, but a handle must not be looked up in
+ * one thread while its entry is released in another one.
+ */
+struct SIGC_API slot_handle_table
+{
+  /** Acquires an entry that refers to @a slot.
+   * @param slot The slot.
+   * @return The handle of the new entry.
+   */
+  static slot_handle acquire(slot_base* slot);
+
+  /** Releases an entry, invalidating all of its handles.
+   * @param index The index of the entry.
+   */
+  static void release(std::uint32_t index) noexcept;
+
+  /** Returns the generation of an acquired entry.
+   * @param index The index of the entry.
+   */
+  static std::uint32_t generation(std::uint32_t index) noexcept;
+
+  /** Looks up the slot that @a handle refers to.
+   * @param handle The handle.
+   * @return The slot, or @p nullptr if the handle is stale or invalid.
+   */
+  static slot_base* lookup(slot_handle handle) noexcept;
+};
+
 using hook = void* (*)(void*);
 
+/** Throws std::logic_error.
+ * Called when a slot with a move-only functor is copied.
+ */
+[[noreturn]] SIGC_API void throw_functor_not_copyable();
+
 /** Internal representation of a slot.
  * Derivations of this class can be considered as a link
  * between a slot and the functor that the slot should
@@ -49,8 +118,14 @@ using hook = void* (*)(void*);
  *   -# a generic function pointer, call_, that is simply
  *      set to zero in notify_slot_rep_invalidated() to invalidate the slot.
  *
- * slot_rep inherits trackable so that connection objects can
- * refer to the slot and are notified when the slot is destroyed.
+ * slot_rep inherits trackable so that other objects can be notified
+ * when the slot is destroyed. Connection objects refer to the slot
+ * through a slot_handle instead, see handle().
+ *
+ * Copies of a slot that is not connected to a parent can share one slot_rep,
+ * if the derived class has called enable_sharing(). The slot_rep is then
+ * reference-counted, and a slot that is about to be connected, disconnected
+ * or otherwise modified makes its own copy first, see slot_base::unshare().
  */
 struct SIGC_API slot_rep : public trackable
 {
@@ -66,9 +141,48 @@ public:
    * down dereferencing of slot list iterators. Martin. */
   // TODO: Try this now? murrayc.
 
-  inline slot_rep(hook call__) noexcept : call_(call__), cleanup_(nullptr), parent_(nullptr) {}
+  inline slot_rep(hook call__) noexcept
+  : call_(call__),
+    move_call_(nullptr),
+    cleanup_(nullptr),
+    parent_(nullptr),
+    bind_handle_(trackable_callback_list::invalid_handle),
+    handle_index_(slot_handle::invalid_index),
+    share_count_(0)
+  {
+  }
+
+  /** Constructs a slot_rep whose trackable callback list is allocated from @a resource.
+   * Thus the connections that refer to the slot allocate from @a resource.
+   */
+  inline slot_rep(hook call__, std::pmr::memory_resource* resource)
+  : trackable(resource),
+    call_(call__),
+    move_call_(nullptr),
+    cleanup_(nullptr),
+    parent_(nullptr),
+    bind_handle_(trackable_callback_list::invalid_handle),
+    handle_index_(slot_handle::invalid_index),
+    share_count_(0)
+  {
+  }
+
+  /** Constructs a slot_rep that uses a callback list owned by a derived class.
+   * See trackable(internal::trackable_callback_list*).
+   */
+  inline slot_rep(hook call__, trackable_callback_list* list) noexcept
+  : trackable(list),
+    call_(call__),
+    move_call_(nullptr),
+    cleanup_(nullptr),
+    parent_(nullptr),
+    bind_handle_(trackable_callback_list::invalid_handle),
+    handle_index_(slot_handle::invalid_index),
+    share_count_(0)
+  {
+  }
 
-  virtual ~slot_rep() {}
+  virtual ~slot_rep() { release_handle(); }
 
 // only MSVC needs this to guarantee that all new/delete are executed from the DLL module
 #ifdef SIGC_NEW_DELETE_IN_LIBRARY_ONLY
@@ -81,10 +195,29 @@ public:
   virtual void destroy() = 0;
 
   /** Makes a deep copy of the slot_rep object.
+   * A slot_rep that has been allocated from a std::pmr::memory_resource
+   * allocates the copy from the same resource.
    * @return A deep copy of the slot_rep object.
    */
   virtual slot_rep* clone() const = 0;
 
+  /** Makes a deep copy of the slot_rep object in memory from @a resource.
+   * @param resource The memory resource, or @p nullptr to use operator new.
+   * @return A deep copy of the slot_rep object.
+   */
+  virtual slot_rep* clone_in(std::pmr::memory_resource* resource) const;
+
+  /** Returns the memory resource that the slot_rep object has been allocated from.
+   * @return The memory resource, or @p nullptr if it's been allocated with operator new.
+   */
+  virtual std::pmr::memory_resource* resource() const noexcept;
+
+  /** Destroys and deletes the slot_rep object.
+   * Use it instead of the delete operator, which can't return memory
+   * to a std::pmr::memory_resource.
+   */
+  virtual void release() noexcept;
+
   /** Set the parent with a callback.
    * slots have one parent exclusively.
    * @param parent The new parent.
@@ -108,6 +241,26 @@ public:
   /// Invalidates the slot and executes the parent's cleanup callback.
   void disconnect();
 
+  /** Returns a handle that connection objects can use to refer to @a slot.
+   * The slot_rep acquires an entry in the slot_handle_table the first time
+   * it's called. Later calls return the same handle.
+   * @param slot The slot that contains this slot_rep.
+   * @return The handle.
+   */
+  slot_handle handle(slot_base* slot);
+
+  /** Invalidates the handles that have been returned by handle().
+   * Called when the slot_rep is deleted or moved to another slot.
+   */
+  inline void release_handle() noexcept
+  {
+    if (handle_index_ != slot_handle::invalid_index)
+    {
+      slot_handle_table::release(handle_index_);
+      handle_index_ = slot_handle::invalid_index;
+    }
+  }
+
   /** Callback that invalidates the slot.
    * This callback is registered in every object of a trackable
    * inherited type that is referred by this slot_rep object.
@@ -117,6 +270,44 @@ public:
    */
   static void notify_slot_rep_invalidated(notifiable* data);
 
+  /** Returns whether another slot may refer to this slot_rep instead of a copy of it.
+   * That's the case if sharing is enabled, and the slot has neither a parent
+   * nor a handle, and has not been invalidated.
+   */
+  inline bool shareable() const noexcept
+  {
+    return share_count_.load(std::memory_order_relaxed) != 0 && !parent_ &&
+           handle_index_ == slot_handle::invalid_index && call_;
+  }
+
+  /** Returns whether more than one slot refers to this slot_rep.
+   */
+  inline bool shared() const noexcept
+  {
+    return share_count_.load(std::memory_order_acquire) > 1;
+  }
+
+  /** Adds a reference from another slot.
+   * Only valid if shareable() returns @p true.
+   */
+  inline void reference() noexcept { share_count_.fetch_add(1, std::memory_order_relaxed); }
+
+  /** Removes a reference from a slot.
+   * @return @p true if the caller held the last reference, and shall release() the slot_rep.
+   */
+  inline bool unreference() noexcept
+  {
+    return share_count_.load(std::memory_order_acquire) == 0 ||
+           share_count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+protected:
+  /** Lets copies of the slot share this slot_rep.
+   * A derived class calls it from its constructor, if its functor is immutable,
+   * see sigc::slot_rep_sharing.
+   */
+  inline void enable_sharing() noexcept { share_count_.store(1, std::memory_order_relaxed); }
+
 public:
   /// Callback that invokes the contained functor.
   /* This can't be a virtual function since number of arguments
@@ -125,11 +316,30 @@ public:
    */
   hook call_;
 
+  /** Callback that invokes the contained functor, moving the arguments that are passed by value.
+   * It's used by signal::emit_move() for the last slot. If it's @p nullptr,
+   * the functor can't take those arguments as rvalues, and call_ is used instead.
+   */
+  hook move_call_;
+
   /** Callback of parent_. */
   notifiable::func_destroy_notify cleanup_;
 
   /** Parent object whose callback cleanup_ is executed on notification. */
   notifiable* parent_;
+
+  /** The handle of the callback that slot_do_bind added to the first trackable target.
+   * slot_do_unbind passes it to remove_destroy_notify_callback(), so that
+   * destroying a slot doesn't search the callback list of its object.
+   */
+  trackable::callback_handle bind_handle_;
+
+private:
+  /// The entry in the slot_handle_table, if handle() has been called.
+  std::uint32_t handle_index_;
+
+  /// The number of slots that refer to this slot_rep, or 0 if it can't be shared.
+  std::atomic<std::uint32_t> share_count_;
 };
 
 /** Functor used to add a dependency to a trackable.
@@ -151,7 +361,10 @@ struct SIGC_API slot_do_bind
    */
   inline void operator()(const trackable& t) const
   {
-    t.add_destroy_notify_callback(rep_, &slot_rep::notify_slot_rep_invalidated);
+    const auto handle =
+      t.add_destroy_notify_callback(rep_, &slot_rep::notify_slot_rep_invalidated);
+    if (rep_->bind_handle_ == trackable_callback_list::invalid_handle)
+      rep_->bind_handle_ = handle;
   }
 };
 
@@ -167,9 +380,14 @@ struct SIGC_API slot_do_unbind
   inline explicit slot_do_unbind(slot_rep* rep) noexcept : rep_(rep) {}
 
   /** Removes a dependency from @p t.
+   * The handle of the first target is tried first. If @p t is another target,
+   * its callback is searched for.
    * @param t The trackable object to remove the callback from.
    */
-  inline void operator()(const trackable& t) const { t.remove_destroy_notify_callback(rep_); }
+  inline void operator()(const trackable& t) const
+  {
+    t.remove_destroy_notify_callback(rep_, rep_->bind_handle_);
+  }
 };
 
 } // namespace internal
@@ -251,8 +469,8 @@ struct SIGC_API slot_do_unbind
  * The internal representation of a sigc::internal::slot_rep derived
  * type is built from %slot_base's derivations. set_parent() is used to
  * register a notification callback that is executed when the slot gets
- * invalid. add_destroy_notify_callback() is used by connection objects
- * to add a notification callback that is executed on destruction.
+ * invalid. add_destroy_notify_callback() can be used to add a
+ * notification callback that is executed on destruction.
  *
  * @ingroup slot
  */
@@ -304,14 +522,16 @@ public:
    * @param parent The new parent.
    * @param cleanup The notification callback.
    */
-  void set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const noexcept;
+  void set_parent(notifiable* parent, notifiable::func_destroy_notify cleanup) const;
 
   /** Add a callback that is executed (notified) when the slot is destroyed.
    * This function is used internally by connection objects.
    * @param data Passed into func upon notification.
    * @param func Callback executed upon destruction of the object.
+   * @return A handle that makes remove_destroy_notify_callback() fast.
    */
-  void add_destroy_notify_callback(notifiable* data, notifiable::func_destroy_notify func) const;
+  trackable::callback_handle add_destroy_notify_callback(
+    notifiable* data, notifiable::func_destroy_notify func) const;
 
   /** Remove a callback previously installed with add_destroy_notify_callback().
    * The callback is not executed.
@@ -319,6 +539,13 @@ public:
    */
   void remove_destroy_notify_callback(notifiable* data) const;
 
+  /** Remove a callback previously installed with add_destroy_notify_callback().
+   * The callback is not executed.
+   * @param data Parameter passed into previous call to add_destroy_notify_callback().
+   * @param handle The value returned by add_destroy_notify_callback().
+   */
+  void remove_destroy_notify_callback(notifiable* data, trackable::callback_handle handle) const;
+
   /** Returns whether the slot is invalid.
    * @return @p true if the slot is invalid (empty).
    */
@@ -349,6 +576,14 @@ public:
    */
   void disconnect();
 
+  /** Gives the slot its own copy of a slot_rep that it shares with other slots.
+   * Copies of a slot share the slot_rep, if the functor is immutable, until
+   * one of them is connected to a parent, disconnected, or handed to a
+   * sigc::connection. Those operations call unshare() themselves. Code that
+   * modifies the slot_rep in other ways must call it first.
+   */
+  void unshare() const;
+
   // The Tru64 and Solaris Forte 5.5 compilers needs this operator=() to be public. I'm not sure
   // why, or why it needs to be protected usually. murrayc.
   // See bug #168265.
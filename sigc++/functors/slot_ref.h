@@ -0,0 +1,167 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+#ifndef SIGC_FUNCTORS_SLOT_REF_H
+#define SIGC_FUNCTORS_SLOT_REF_H
+
+#include <sigc++/functors/slot.h>
+#include <sigc++/type_traits.h>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+/** The target of a slot_ref: either a functor object, or a function.
+ * Function pointers are stored by value, because a pointer to them would
+ * often point to a temporary object.
+ */
+union slot_ref_target
+{
+  void* object_ = nullptr;
+  void (*function_)();
+};
+
+/** Abstracts functor execution for slot_ref, like slot_call does for slot.
+ * call_it() invokes the target of a slot_ref, whose type is @e T_functor.
+ *
+ * The following template arguments are used:
+ * - @e T_functor The functor type, possibly const, or a function pointer type.
+ * - @e T_return The return type of call_it().
+ * - @e T_arg Argument types used in the definition of call_it().
+ */
+template<typename T_functor, typename T_return, typename... T_arg>
+struct slot_ref_call
+{
+  /** Invokes a functor of type @p T_functor.
+   * @param target The target of a slot_ref.
+   * @param a Arguments to be passed on to the functor.
+   * @return The return values of the functor invocation.
+   */
+  static T_return call_it(slot_ref_target target, type_trait_take_t<T_arg>... a_)
+  {
+    if constexpr (std::is_pointer_v<T_functor>)
+    {
+      return std::invoke(sigc::internal::function_pointer_cast<T_functor>(target.function_),
+        std::forward<type_trait_take_t<T_arg>>(a_)...);
+    }
+    else
+    {
+      return std::invoke(
+        *static_cast<T_functor*>(target.object_), std::forward<type_trait_take_t<T_arg>>(a_)...);
+    }
+  }
+};
+
+} /* namespace internal */
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename T_signature>
+class slot_ref;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** Non-owning reference to a functor, with the call signature of a sigc::slot.
+ *
+ * A sigc::slot allocates memory for a copy of its functor. A slot_ref instead
+ * refers to a functor that's owned by someone else. It consists of two
+ * pointers, it's trivially copyable, and constructing it never allocates
+ * memory. It's meant for parameters of functions that call a callback before
+ * they return, such as helpers that are called during emission, or
+ * accumulators:
+ * @code
+ * void parse(std::string_view text, sigc::slot_ref<void(std::string_view token)> on_token);
+ *
+ * parse(text, [&tokens](std::string_view token) { tokens.emplace_back(token); });
+ * @endcode
+ *
+ * The referenced functor must outlive the slot_ref. A slot_ref does not track
+ * sigc::trackable objects, and can't be blocked or disconnected. A slot_ref
+ * can refer to a sigc::slot, which is then invoked with the usual checks.
+ *
+ * @ingroup slot
+ */
+template<typename T_return, typename... T_arg>
+class slot_ref<T_return(T_arg...)>
+{
+public:
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  using call_type = T_return (*)(internal::slot_ref_target, type_trait_take_t<T_arg>...);
+#endif
+
+  /// Constructs an empty slot_ref.
+  slot_ref() noexcept = default;
+
+  /** Constructs a slot_ref that refers to a functor.
+   * It only takes part in overload resolution if @a func can be invoked with
+   * the arguments of the slot_ref, and its result converted to @e T_return.
+   * @param func The functor. If it's a function or a function pointer,
+   *        the slot_ref stores a copy of the function pointer.
+   */
+  template<typename T_functor,
+    typename = std::enable_if_t<!std::is_same_v<std::decay_t<T_functor>, slot_ref> &&
+                                std::is_invocable_r_v<T_return,
+                                  std::remove_reference_t<T_functor>&,
+                                  type_trait_take_t<T_arg>...>>>
+  slot_ref(T_functor&& func) noexcept
+  {
+    using functor_type = std::remove_reference_t<T_functor>;
+    if constexpr (std::is_function_v<std::remove_pointer_t<std::decay_t<T_functor>>>)
+    {
+      using pointer_type = std::decay_t<T_functor>;
+      target_.function_ = sigc::internal::function_pointer_cast<void (*)()>(pointer_type(func));
+      call_ = &internal::slot_ref_call<pointer_type, T_return, T_arg...>::call_it;
+    }
+    else
+    {
+      target_.object_ = const_cast<void*>(static_cast<const void*>(std::addressof(func)));
+      call_ = &internal::slot_ref_call<functor_type, T_return, T_arg...>::call_it;
+    }
+  }
+
+  /** Invokes the referenced functor.
+   * @param a Arguments to be passed on to the functor.
+   * @return The return value of the functor invocation, or a default-constructed
+   *         value if the slot_ref is empty.
+   */
+  inline T_return operator()(type_trait_take_t<T_arg>... a) const
+  {
+    if (call_)
+      return call_(target_, std::forward<type_trait_take_t<T_arg>>(a)...);
+
+    return T_return();
+  }
+
+  /// Returns whether the slot_ref refers to no functor.
+  inline bool empty() const noexcept { return !call_; }
+
+  /// Returns whether the slot_ref refers to a functor.
+  inline explicit operator bool() const noexcept { return call_ != nullptr; }
+
+private:
+  internal::slot_ref_target target_;
+  call_type call_ = nullptr;
+};
+
+} /* namespace sigc */
+
+#endif /* SIGC_FUNCTORS_SLOT_REF_H */
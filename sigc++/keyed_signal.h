@@ -0,0 +1,237 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_KEYED_SIGNAL_H
+#define SIGC_KEYED_SIGNAL_H
+
+#include <sigc++/signal.h>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+namespace sigc
+{
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename T_key,
+  typename T_signature,
+  typename T_hash = std::hash<T_key>,
+  typename T_key_equal = std::equal_to<T_key>>
+class keyed_signal;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** Signal whose slots are registered under keys.
+ * connect() registers a slot under a key. emit() invokes only the slots that
+ * have been registered under the given key. They are found by a hash lookup,
+ * so the cost of an emission does not depend on the number of slots that
+ * are registered under other keys.
+ *
+ * Each key has its own sigc::signal. The slots of a key are invoked
+ * in the same order, and with the same return value, as the slots of a
+ * sigc::signal. Slots can be connected and disconnected during emission.
+ *
+ * A key is forgotten by clear(key). When all slots of a key are disconnected
+ * otherwise, the key is kept until prune() is called. connect() calls prune()
+ * whenever the number of keys has doubled since the last time, so the keys
+ * without slots never outnumber the keys with slots by much.
+ *
+ * @par Example:
+ * @code
+ * sigc::keyed_signal<int, void(const Message&)> dispatcher;
+ * dispatcher.connect(MSG_OPEN, sigc::mem_fun(handler, &Handler::on_open));
+ * dispatcher.connect(MSG_CLOSE, sigc::mem_fun(handler, &Handler::on_close));
+ * dispatcher.emit(msg.type, msg); // Invokes one of the slots.
+ * @endcode
+ *
+ * @tparam T_key The type of the keys.
+ * @tparam T_hash The hash function of the keys.
+ * @tparam T_key_equal The equality comparison of the keys.
+ *
+ * @ingroup signal
+ */
+template<typename T_key,
+  typename T_return,
+  typename... T_arg,
+  typename T_hash,
+  typename T_key_equal>
+class keyed_signal<T_key, T_return(T_arg...), T_hash, T_key_equal>
+{
+public:
+  using key_type = T_key;
+  using signal_type = signal<T_return(T_arg...)>;
+  using slot_type = slot<T_return(T_arg...)>;
+  using size_type = std::size_t;
+
+  keyed_signal() = default;
+
+  keyed_signal(const keyed_signal& src) = delete;
+  keyed_signal& operator=(const keyed_signal& src) = delete;
+
+  keyed_signal(keyed_signal&& src) = default;
+  keyed_signal& operator=(keyed_signal&& src) = default;
+
+  /** Adds a slot at the end of the list of slots of a key.
+   * @param key The key.
+   * @param slot_ The slot to add.
+   * @return A connection.
+   */
+  connection connect(const key_type& key, const slot_type& slot_)
+  {
+    return find_or_add(key).connect(slot_);
+  }
+
+  /** Adds a slot at the end of the list of slots of a key.
+   * @see connect(const key_type& key, const slot_type& slot_).
+   */
+  connection connect(const key_type& key, slot_type&& slot_)
+  {
+    return find_or_add(key).connect(std::move(slot_));
+  }
+
+  /** Adds a slot to the list of slots of a key, ordered by priority.
+   * See @ref sigc::signal_with_accumulator::connect(const slot_type&, int)
+   * "sigc::signal::connect(slot, priority)".
+   * @param key The key.
+   * @param slot_ The slot to add.
+   * @param priority The priority of the slot.
+   * @return A connection.
+   */
+  connection connect(const key_type& key, const slot_type& slot_, int priority)
+  {
+    return find_or_add(key).connect(slot_, priority);
+  }
+
+  /** Adds a slot to the list of slots of a key, ordered by priority.
+   * @see connect(const key_type& key, const slot_type& slot_, int priority).
+   */
+  connection connect(const key_type& key, slot_type&& slot_, int priority)
+  {
+    return find_or_add(key).connect(std::move(slot_), priority);
+  }
+
+  /** Invokes the slots that have been registered under @a key.
+   * @param key The key.
+   * @param a Arguments to be passed on to the slots.
+   * @return The return value of the last slot invoked, or a default-constructed
+   *         value if no slot has been invoked.
+   */
+  T_return emit(const key_type& key, type_trait_take_t<T_arg>... a) const
+  {
+    const auto iter = signals_.find(key);
+    if (iter == signals_.end())
+      return T_return();
+
+    return iter->second.emit(std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Invokes the slots that have been registered under @a key (see emit()). */
+  T_return operator()(const key_type& key, type_trait_take_t<T_arg>... a) const
+  {
+    return emit(key, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Returns the number of slots that are registered under @a key.
+   * @param key The key.
+   */
+  size_type size(const key_type& key) const noexcept
+  {
+    const auto iter = signals_.find(key);
+    return iter != signals_.end() ? iter->second.size() : 0;
+  }
+
+  /** Returns whether no slots are registered under any key.
+   * This checks the keys one by one, until one with slots is found.
+   */
+  bool empty() const noexcept
+  {
+    for (const auto& entry : signals_)
+    {
+      if (!entry.second.empty())
+        return false;
+    }
+    return true;
+  }
+
+  /** Disconnects the slots that are registered under @a key.
+   * @param key The key.
+   */
+  void clear(const key_type& key)
+  {
+    const auto iter = signals_.find(key);
+    if (iter != signals_.end())
+    {
+      iter->second.clear();
+      signals_.erase(iter);
+    }
+  }
+
+  /// Disconnects all slots.
+  void clear()
+  {
+    for (auto& entry : signals_)
+      entry.second.clear();
+    signals_.clear();
+    prune_size_ = min_prune_size;
+  }
+
+  /** Forgets the keys that no slots are registered under any more.
+   * Disconnecting the last slot of a key doesn't remove the key, so that
+   * connecting to it again is cheap.
+   */
+  void prune()
+  {
+    for (auto iter = signals_.begin(); iter != signals_.end();)
+    {
+      if (iter->second.empty())
+        iter = signals_.erase(iter);
+      else
+        ++iter;
+    }
+    prune_size_ = std::max(2 * signals_.size(), min_prune_size);
+  }
+
+private:
+  // The number of keys below which connect() doesn't call prune().
+  static constexpr size_type min_prune_size = 16;
+
+  signal_type& find_or_add(const key_type& key)
+  {
+    const auto iter = signals_.find(key);
+    if (iter != signals_.end())
+      return iter->second;
+
+    if (signals_.size() >= prune_size_)
+      prune();
+    return signals_[key];
+  }
+
+  /* The signals of the keys. Unordered maps don't move their elements,
+   * so a signal can be erased or another one inserted during its emission.
+   */
+  std::unordered_map<key_type, signal_type, T_hash, T_key_equal> signals_;
+
+  // The number of keys at which connect() calls prune().
+  size_type prune_size_ = min_prune_size;
+};
+
+} /* namespace sigc */
+
+#endif /* SIGC_KEYED_SIGNAL_H */
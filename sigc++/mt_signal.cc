@@ -0,0 +1,247 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#include <sigc++/mt_signal.h>
+#include <algorithm>
+#include <iterator>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+mt_signal_impl::mt_signal_impl()
+: current_(new mt_slot_snapshot), entering_(0), has_retired_(false), retired_(nullptr)
+{
+}
+
+mt_signal_impl::~mt_signal_impl()
+{
+  // No reader can be active. A reader keeps a std::shared_ptr to this.
+  delete_snapshots(retired_);
+  delete current_.load();
+}
+
+const mt_slot_snapshot*
+mt_signal_impl::enter() noexcept
+{
+  // Registering in entering_ before loading current_ guarantees that a writer,
+  // which stores current_ before it checks entering_, either sees this thread
+  // or has already published the snapshot that this thread loads. A thread
+  // that has left entering_ is visible in the reader count of its snapshot.
+  // All of these operations are sequentially consistent.
+  entering_.fetch_add(1);
+  const auto snapshot = current_.load();
+  snapshot->readers_.fetch_add(1);
+  entering_.fetch_sub(1);
+  return snapshot;
+}
+
+void
+mt_signal_impl::leave(const mt_slot_snapshot* snapshot) noexcept
+{
+  // The snapshot may be deleted by another thread as soon as its reader
+  // count is 0, so it's not accessed after the decrement.
+  if (snapshot->readers_.fetch_sub(1) != 1 || !has_retired_.load())
+    return;
+
+  // This was the last reader of the snapshot, which may be retired.
+  // Writers hold the lock only briefly, and never while slots are invoked.
+  mt_slot_snapshot* reclaimable = nullptr;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    reclaimable = take_reclaimable();
+  }
+
+  // Delete the slots without holding the lock. A slot's destructor might
+  // connect or disconnect slots.
+  delete_snapshots(reclaimable);
+}
+
+void
+mt_signal_impl::publish(mt_slot_snapshot* snapshot) noexcept
+{
+  auto old = current_.exchange(snapshot);
+  old->next_retired_ = retired_;
+  retired_ = old;
+  has_retired_.store(true);
+}
+
+mt_slot_snapshot*
+mt_signal_impl::take_reclaimable() noexcept
+{
+  // A thread that enters after this check loads the snapshot that is
+  // current now, not one of the retired ones.
+  if (!retired_ || entering_.load() != 0)
+    return nullptr;
+
+  mt_slot_snapshot* reclaimable = nullptr;
+  auto link = &retired_;
+  while (const auto snapshot = *link)
+  {
+    if (snapshot->readers_.load() == 0)
+    {
+      *link = snapshot->next_retired_;
+      snapshot->next_retired_ = reclaimable;
+      reclaimable = snapshot;
+    }
+    else
+      link = &snapshot->next_retired_;
+  }
+
+  has_retired_.store(retired_ != nullptr);
+  return reclaimable;
+}
+
+// static
+void
+mt_signal_impl::delete_snapshots(mt_slot_snapshot* snapshots) noexcept
+{
+  while (snapshots)
+  {
+    auto next = snapshots->next_retired_;
+    delete snapshots;
+    snapshots = next;
+  }
+}
+
+std::shared_ptr<mt_slot_entry>
+mt_signal_impl::connect(slot_base&& slot, bool first)
+{
+  auto entry = std::make_shared<mt_slot_entry>(std::move(slot));
+  mt_slot_snapshot* reclaimable = nullptr;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto& entries = current_.load()->entries_;
+
+    auto snapshot = std::make_unique<mt_slot_snapshot>();
+    snapshot->entries_.reserve(entries.size() + 1);
+    if (first)
+      snapshot->entries_.push_back(entry);
+    snapshot->entries_.insert(snapshot->entries_.end(), entries.begin(), entries.end());
+    if (!first)
+      snapshot->entries_.push_back(entry);
+
+    publish(snapshot.release());
+    reclaimable = take_reclaimable();
+  }
+
+  delete_snapshots(reclaimable);
+  return entry;
+}
+
+void
+mt_signal_impl::disconnect(mt_slot_entry* entry)
+{
+  // Emissions that start after this won't invoke the slot,
+  // even if they load the old snapshot.
+  if (!entry->connected_.exchange(false))
+    return;
+
+  mt_slot_snapshot* reclaimable = nullptr;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto& entries = current_.load()->entries_;
+
+    auto snapshot = std::make_unique<mt_slot_snapshot>();
+    snapshot->entries_.reserve(entries.size());
+    std::copy_if(entries.begin(), entries.end(), std::back_inserter(snapshot->entries_),
+      [entry](const std::shared_ptr<mt_slot_entry>& e) { return e.get() != entry; });
+
+    publish(snapshot.release());
+    reclaimable = take_reclaimable();
+  }
+
+  delete_snapshots(reclaimable);
+}
+
+void
+mt_signal_impl::clear()
+{
+  mt_slot_snapshot* reclaimable = nullptr;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : current_.load()->entries_)
+      entry->connected_.store(false);
+
+    publish(new mt_slot_snapshot);
+    reclaimable = take_reclaimable();
+  }
+
+  delete_snapshots(reclaimable);
+}
+
+mt_signal_impl::size_type
+mt_signal_impl::size() noexcept
+{
+  const read_guard guard(*this);
+  return guard.snapshot().entries_.size();
+}
+
+} /* namespace internal */
+
+mt_connection::mt_connection(const std::shared_ptr<internal::mt_signal_impl>& impl,
+  const std::shared_ptr<internal::mt_slot_entry>& entry) noexcept
+: impl_(impl), entry_(entry)
+{
+}
+
+bool
+mt_connection::connected() const noexcept
+{
+  const auto entry = entry_.lock();
+  return entry && entry->connected_.load();
+}
+
+bool
+mt_connection::blocked() const noexcept
+{
+  const auto entry = entry_.lock();
+  return entry && entry->blocked_.load();
+}
+
+bool
+mt_connection::block(bool should_block) noexcept
+{
+  const auto entry = entry_.lock();
+  return entry && entry->blocked_.exchange(should_block);
+}
+
+bool
+mt_connection::unblock() noexcept
+{
+  return block(false);
+}
+
+void
+mt_connection::disconnect()
+{
+  const auto entry = entry_.lock();
+  const auto impl = impl_.lock();
+  if (entry && impl)
+    impl->disconnect(entry.get());
+}
+
+mt_connection::operator bool() const noexcept
+{
+  return connected();
+}
+
+} /* namespace sigc */
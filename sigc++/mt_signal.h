@@ -0,0 +1,368 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_MT_SIGNAL_H
+#define SIGC_MT_SIGNAL_H
+
+#include <sigc++config.h>
+#include <sigc++/functors/slot.h>
+#include <sigc++/type_traits.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sigc
+{
+
+namespace internal
+{
+
+/** A slot that is connected to a sigc::mt_signal.
+ * The connection and blocking states are atomic, so that they can be
+ * changed by one thread while another thread emits the signal.
+ */
+struct SIGC_API mt_slot_entry
+{
+  explicit mt_slot_entry(slot_base&& slot)
+  : slot_(std::move(slot)), connected_(true), blocked_(false)
+  {
+  }
+
+  mt_slot_entry(const mt_slot_entry& src) = delete;
+  mt_slot_entry& operator=(const mt_slot_entry& src) = delete;
+  mt_slot_entry(mt_slot_entry&& src) = delete;
+  mt_slot_entry& operator=(mt_slot_entry&& src) = delete;
+
+  slot_base slot_;
+  std::atomic<bool> connected_;
+  std::atomic<bool> blocked_;
+};
+
+/** An immutable array of the slots that are connected to a sigc::mt_signal.
+ * A snapshot is never modified once it has been published.
+ * Connecting and disconnecting slots publish a new snapshot.
+ */
+struct SIGC_API mt_slot_snapshot
+{
+  std::vector<std::shared_ptr<mt_slot_entry>> entries_;
+
+  /// The number of emissions that use the snapshot.
+  mutable std::atomic<std::size_t> readers_{ 0 };
+
+  /// The next snapshot in the list of retired snapshots.
+  mt_slot_snapshot* next_retired_ = nullptr;
+};
+
+/** Implementation of sigc::mt_signal.
+ * Emitting threads read the current snapshot without taking a lock.
+ * They only register themselves in the reader count of the snapshot.
+ * While a thread loads the snapshot and registers, it's also counted in
+ * entering_, so that a writer can tell that no thread is about to register
+ * in a snapshot that it has retired.
+ *
+ * Modifications are serialized by a mutex. They publish a new snapshot
+ * and retire the old one. A retired snapshot, and the slots that are only
+ * referenced by it, are deleted as soon as it has no readers, either by the
+ * next modification or by its last reader. Emissions of other snapshots
+ * don't keep it alive.
+ */
+class SIGC_API mt_signal_impl
+{
+public:
+  using size_type = std::size_t;
+
+  mt_signal_impl();
+  ~mt_signal_impl();
+
+  mt_signal_impl(const mt_signal_impl& src) = delete;
+  mt_signal_impl& operator=(const mt_signal_impl& src) = delete;
+  mt_signal_impl(mt_signal_impl&& src) = delete;
+  mt_signal_impl& operator=(mt_signal_impl&& src) = delete;
+
+  /// Keeps the current snapshot alive while the signal is being emitted.
+  class read_guard
+  {
+  public:
+    inline explicit read_guard(mt_signal_impl& impl) noexcept
+    : impl_(impl), snapshot_(impl.enter())
+    {
+    }
+
+    read_guard(const read_guard& src) = delete;
+    read_guard& operator=(const read_guard& src) = delete;
+    read_guard(read_guard&& src) = delete;
+    read_guard& operator=(read_guard&& src) = delete;
+
+    inline ~read_guard() { impl_.leave(snapshot_); }
+
+    inline const mt_slot_snapshot& snapshot() const noexcept { return *snapshot_; }
+
+  private:
+    mt_signal_impl& impl_;
+    const mt_slot_snapshot* snapshot_;
+  };
+
+  /** Adds a slot to the signal.
+   * @param slot The slot to add.
+   * @param first Whether the slot shall be invoked before the other slots.
+   * @return The entry of the new slot.
+   */
+  std::shared_ptr<mt_slot_entry> connect(slot_base&& slot, bool first);
+
+  /** Removes a slot from the signal.
+   * The slot is not invoked by emissions that start after this call.
+   * @param entry The entry of the slot to remove.
+   */
+  void disconnect(mt_slot_entry* entry);
+
+  /// Removes all slots from the signal.
+  void clear();
+
+  /// Returns the number of connected slots.
+  size_type size() noexcept;
+
+private:
+  const mt_slot_snapshot* enter() noexcept;
+  void leave(const mt_slot_snapshot* snapshot) noexcept;
+
+  // These functions must be called while mutex_ is locked.
+  void publish(mt_slot_snapshot* snapshot) noexcept;
+  mt_slot_snapshot* take_reclaimable() noexcept;
+
+  static void delete_snapshots(mt_slot_snapshot* snapshots) noexcept;
+
+  std::atomic<mt_slot_snapshot*> current_;
+
+  /// The number of threads that are registering in a snapshot, see enter().
+  std::atomic<size_type> entering_;
+  std::atomic<bool> has_retired_;
+
+  /// Retired snapshots, linked through mt_slot_snapshot::next_retired_.
+  mt_slot_snapshot* retired_;
+
+  std::mutex mutex_;
+};
+
+} /* namespace internal */
+
+/** Convenience class for the disconnection of a slot from a sigc::mt_signal.
+ * Like sigc::connection, but the connection can be used from any thread,
+ * and it stays valid after the signal has been destroyed.
+ *
+ * @ingroup signal
+ */
+class SIGC_API mt_connection
+{
+public:
+  /** Constructs an empty connection object. */
+  mt_connection() noexcept = default;
+
+  /** Returns whether the connection is still active.
+   * @return @p true if the connection is still active.
+   */
+  bool connected() const noexcept;
+
+  /** Returns whether the connection is blocked.
+   * @return @p true if the connection is blocked.
+   */
+  bool blocked() const noexcept;
+
+  /** Sets or unsets the blocking state of this connection.
+   * @param should_block Indicates whether the blocking state should be set or unset.
+   * @return @p true if the connection has been in blocking state before.
+   */
+  bool block(bool should_block = true) noexcept;
+
+  /** Unsets the blocking state of this connection.
+   * @return @p true if the connection has been in blocking state before.
+   */
+  bool unblock() noexcept;
+
+  /** Disconnects the referred slot.
+   * Emissions that are in progress in other threads may still invoke the slot.
+   */
+  void disconnect();
+
+  /** Returns whether the connection is still active.
+   * @return @p true if the connection is still active.
+   */
+  explicit operator bool() const noexcept;
+
+private:
+  template<typename T_signature>
+  friend class mt_signal;
+
+  mt_connection(const std::shared_ptr<internal::mt_signal_impl>& impl,
+    const std::shared_ptr<internal::mt_slot_entry>& entry) noexcept;
+
+  std::weak_ptr<internal::mt_signal_impl> impl_;
+  std::weak_ptr<internal::mt_slot_entry> entry_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename T_signature>
+class mt_signal;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** Signal that can be emitted and modified from several threads at the same time.
+ * The interface is a subset of sigc::signal's. Emission doesn't take a lock.
+ * It walks an immutable snapshot of the connected slots. connect(),
+ * mt_connection::disconnect() and clear() publish a new snapshot,
+ * so they are more expensive than their sigc::signal counterparts.
+ *
+ * A slot that is disconnected while another thread emits the signal may
+ * be invoked by that emission, but not by later ones. It's deleted when
+ * no emission that might use it is in progress.
+ *
+ * The slots themselves are not made thread-safe. In particular, a slot
+ * must not be invalidated by the destruction of a sigc::trackable while
+ * other threads may emit the signal. Use mt_connection::disconnect() instead.
+ *
+ * Copies of an mt_signal share the same list of slots.
+ *
+ * @par Example:
+ * @code
+ * sigc::mt_signal<void(int)> sig;
+ * auto conn = sig.connect([](int i) { std::cout << i; });
+ * std::thread t([&sig]() { sig.emit(1); });
+ * t.join();
+ * conn.disconnect();
+ * @endcode
+ *
+ * @ingroup signal
+ */
+template<typename T_return, typename... T_arg>
+class mt_signal<T_return(T_arg...)>
+{
+public:
+  using slot_type = slot<T_return(T_arg...)>;
+  using size_type = std::size_t;
+
+  mt_signal() : impl_(std::make_shared<internal::mt_signal_impl>()) {}
+
+  mt_signal(const mt_signal& src) = default;
+  mt_signal& operator=(const mt_signal& src) = default;
+
+  /** Adds a slot at the end of the list of connected slots.
+   * @param slot_ The slot to add to the list of slots.
+   * @return A connection.
+   */
+  mt_connection connect(const slot_type& slot_)
+  {
+    return mt_connection(impl_, impl_->connect(slot_base(slot_), false));
+  }
+
+  /** Adds a slot at the end of the list of connected slots.
+   * @param slot_ The slot to move to the list of slots.
+   * @return A connection.
+   */
+  mt_connection connect(slot_type&& slot_)
+  {
+    return mt_connection(impl_, impl_->connect(std::move(slot_), false));
+  }
+
+  /** Adds a slot at the beginning of the list of connected slots.
+   * @param slot_ The slot to add to the list of slots.
+   * @return A connection.
+   */
+  mt_connection connect_first(const slot_type& slot_)
+  {
+    return mt_connection(impl_, impl_->connect(slot_base(slot_), true));
+  }
+
+  /** Adds a slot at the beginning of the list of connected slots.
+   * @param slot_ The slot to move to the list of slots.
+   * @return A connection.
+   */
+  mt_connection connect_first(slot_type&& slot_)
+  {
+    return mt_connection(impl_, impl_->connect(std::move(slot_), true));
+  }
+
+  /** Triggers the emission of the signal.
+   * The connected slots that are not blocked are invoked in order.
+   * @param a Arguments to be passed on to the slots.
+   * @return The return value of the last slot invoked.
+   */
+  T_return emit(type_trait_take_t<T_arg>... a) const
+  {
+    using call_type = typename slot_type::call_type;
+
+    // Keep impl alive, if a slot destroys the signal.
+    const auto impl = impl_;
+    const internal::mt_signal_impl::read_guard guard(*impl);
+
+    if constexpr (std::is_void_v<T_return>)
+    {
+      for (const auto& entry : guard.snapshot().entries_)
+      {
+        const auto& slot = entry->slot_;
+        if (!entry->connected_ || entry->blocked_ || slot.empty())
+          continue;
+
+        (sigc::internal::function_pointer_cast<call_type>(slot.rep_->call_))(
+          slot.rep_, std::forward<type_trait_take_t<T_arg>>(a)...);
+      }
+    }
+    else
+    {
+      T_return r_ = T_return();
+      for (const auto& entry : guard.snapshot().entries_)
+      {
+        const auto& slot = entry->slot_;
+        if (!entry->connected_ || entry->blocked_ || slot.empty())
+          continue;
+
+        r_ = (sigc::internal::function_pointer_cast<call_type>(slot.rep_->call_))(
+          slot.rep_, std::forward<type_trait_take_t<T_arg>>(a)...);
+      }
+      return r_;
+    }
+  }
+
+  /** Triggers the emission of the signal (see emit()). */
+  T_return operator()(type_trait_take_t<T_arg>... a) const
+  {
+    return emit(std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Returns the number of connected slots.
+   * The result may be outdated when it's returned, if other threads modify the signal.
+   */
+  size_type size() const noexcept { return impl_->size(); }
+
+  /** Returns whether no slot is connected.
+   * The result may be outdated when it's returned, if other threads modify the signal.
+   */
+  bool empty() const noexcept { return size() == 0; }
+
+  /// Disconnects all slots.
+  void clear() { impl_->clear(); }
+
+private:
+  std::shared_ptr<internal::mt_signal_impl> impl_;
+};
+
+} /* namespace sigc */
+
+#endif /* SIGC_MT_SIGNAL_H */
@@ -23,8 +23,7 @@
 namespace sigc
 {
 
-// All we are doing is assigning weak_raw_ptr, which is noexcept, so declare it.
-// connectionʼs copy operators can be noexcept for that reason, if breaking ABI.
+// All we are doing is copying a connection, which is noexcept, so declare it.
 scoped_connection::scoped_connection(connection c) noexcept
 : conn_(std::move(c))
 {
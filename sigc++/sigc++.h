@@ -117,6 +117,7 @@
 
 #include <sigc++/signal.h>
 #include <sigc++/connection.h>
+#include <sigc++/connection_group.h>
 #include <sigc++/scoped_connection.h>
 #include <sigc++/trackable.h>
 #include <sigc++/signal_connect.h>
@@ -20,6 +20,7 @@
 #ifndef SIGC_SIGNAL_H
 #define SIGC_SIGNAL_H
 
+#include <iterator>
 #include <list>
 #include <sigc++/connection.h>
 #include <sigc++/signal_base.h>
@@ -33,9 +34,23 @@
 namespace sigc
 {
 
+class thread_pool;
+
 namespace internal
 {
 
+// Defined in <sigc++/thread_pool.h>.
+template<typename T_return, typename... T_arg>
+struct signal_emit_parallel;
+
+// Defined in <sigc++/awaitable.h>.
+template<typename T_return, typename... T_arg>
+class signal_next_awaiter;
+
+// Defined in <sigc++/awaitable.h>.
+template<typename T_return, typename T_accumulator, typename... T_arg>
+class signal_emit_async;
+
 /** Special iterator over sigc::internal::signal_impl's slot list that holds extra data.
  * This iterators is for use in accumulators. operator*() executes
  * the slot. The return value is buffered, so that in an expression
@@ -198,6 +213,9 @@ private:
  *  the end of your list.  This way you may connect during emission without
  *  inadvertently entering an infinite loop, as well as make other
  *  modifications to the slot_list at your own risk.
+ *
+ *  The end of the list is marked by a node that is a member of temp_slot_list.
+ *  It's linked into the slot_list without allocating memory.
  */
 struct temp_slot_list
 {
@@ -207,10 +225,16 @@ struct temp_slot_list
 
   explicit temp_slot_list(slot_list& slots) : slots_(slots)
   {
-    placeholder = slots_.insert(slots_.end(), slot_base());
+    placeholder = slots_.link_marker(slots_.end(), marker_);
   }
 
-  ~temp_slot_list() { slots_.erase(placeholder); }
+  ~temp_slot_list() { slots_.unlink_marker(marker_); }
+
+  temp_slot_list(const temp_slot_list& src) = delete;
+  temp_slot_list& operator=(const temp_slot_list& src) = delete;
+
+  temp_slot_list(temp_slot_list&& src) = delete;
+  temp_slot_list& operator=(temp_slot_list&& src) = delete;
 
   iterator begin() { return slots_.begin(); }
   iterator end() { return placeholder; }
@@ -219,6 +243,7 @@ struct temp_slot_list
 
 private:
   slot_list& slots_;
+  slot_list_node marker_;
   slot_list::iterator placeholder;
 };
 
@@ -261,7 +286,7 @@ struct signal_emit
     if (!impl)
       return accumulator(slot_iterator_buf_type(), slot_iterator_buf_type());
 
-    signal_impl_holder exec(impl);
+    signal_impl_exec_holder exec(impl.get());
     const temp_slot_list slots(impl->slots_);
 
     self_type self(a...);
@@ -299,7 +324,17 @@ public:
     if (!impl || impl->slots_.empty())
       return T_return();
 
-    signal_impl_holder exec(impl);
+    if (const auto slot = impl->single_slot())
+    {
+      if (slot->empty() || slot->blocked())
+        return T_return();
+
+      signal_impl_exec_holder exec(impl.get());
+      return (sigc::internal::function_pointer_cast<call_type>(slot->rep_->call_))(
+        slot->rep_, a...);
+    }
+
+    signal_impl_exec_holder exec(impl.get());
     T_return r_ = T_return();
 
     // Use this scope to make sure that "slots" is destroyed before "exec" is destroyed.
@@ -355,7 +390,19 @@ public:
   {
     if (!impl || impl->slots_.empty())
       return;
-    signal_impl_holder exec(impl);
+
+    if (const auto slot = impl->single_slot())
+    {
+      if (slot->empty() || slot->blocked())
+        return;
+
+      signal_impl_exec_holder exec(impl.get());
+      (sigc::internal::function_pointer_cast<call_type>(slot->rep_->call_))(
+        slot->rep_, std::forward<type_trait_take_t<T_arg>>(a)...);
+      return;
+    }
+
+    signal_impl_exec_holder exec(impl.get());
     const temp_slot_list slots(impl->slots_);
 
     for (const auto& slot : slots)
@@ -369,6 +416,100 @@ public:
   }
 };
 
+/** Abstracts signal emission with emit_move().
+ * It's used for all signals, since emit_move() is only available if no
+ * accumulator is used.
+ */
+template<typename T_return, typename... T_arg>
+struct signal_emit_move
+{
+private:
+  using slot_type = slot<T_return(T_arg...)>;
+  using call_type = typename slot_type::call_type;
+  using move_call_type = typename slot_type::move_call_type;
+  using iterator = temp_slot_list::const_iterator;
+
+public:
+  /** Executes a list of slots, moving the arguments that are passed by value into the last slot.
+   * The other slots get const references to the arguments. The slots are
+   * visited like in signal_emit::emit(), and each one is invoked when it's
+   * visited. Just before a slot is invoked, the following slots are checked,
+   * and it gets the moved arguments if none of them is going to be invoked.
+   * @param a Arguments to be passed on to the slots.
+   * @return The return value of the last slot invoked.
+   */
+  static T_return emit(const std::shared_ptr<internal::signal_impl>& impl,
+    type_trait_take_moving_t<T_arg>... a)
+  {
+    if (!impl || impl->slots_.empty())
+      return T_return();
+
+    if (const auto slot = impl->single_slot())
+    {
+      if (slot->empty() || slot->blocked())
+        return T_return();
+
+      signal_impl_exec_holder exec(impl.get());
+      return call_moving(*slot, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+    }
+
+    signal_impl_exec_holder exec(impl.get());
+
+    // Use this scope to make sure that "slots" is destroyed before "exec" is destroyed.
+    {
+      const temp_slot_list slots(impl->slots_);
+      const auto end = slots.end();
+      if constexpr (std::is_void_v<T_return>)
+      {
+        for (auto it = find_active(slots.begin(), end); it != end;
+             it = find_active(std::next(it), end))
+          invoke(it, end, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+      }
+      else
+      {
+        T_return r_ = T_return();
+        for (auto it = find_active(slots.begin(), end); it != end;
+             it = find_active(std::next(it), end))
+          r_ = invoke(it, end, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+        return r_;
+      }
+    }
+  }
+
+private:
+  // Returns the first slot from @a it on that is neither empty nor blocked.
+  static iterator find_active(iterator it, iterator end)
+  {
+    while (it != end && (it->empty() || it->blocked()))
+      ++it;
+    return it;
+  }
+
+  // Invokes the slot @a it, moving the arguments into it if it's the last active slot.
+  static T_return invoke(iterator it, iterator end, type_trait_take_moving_t<T_arg>... a)
+  {
+    if (find_active(std::next(it), end) == end)
+      return call_moving(*it, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+    return call(*it, a...);
+  }
+
+  static T_return call(const slot_base& slot, type_trait_take_t<T_arg>... a)
+  {
+    return (sigc::internal::function_pointer_cast<call_type>(slot.rep_->call_))(
+      slot.rep_, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  static T_return call_moving(const slot_base& slot, type_trait_take_moving_t<T_arg>... a)
+  {
+    if (slot.rep_->move_call_)
+    {
+      return (sigc::internal::function_pointer_cast<move_call_type>(slot.rep_->move_call_))(
+        slot.rep_, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+    }
+    return call(slot, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+};
+
 } /* namespace internal */
 
 /** Signal declaration.
@@ -416,6 +557,9 @@ public:
    * of such a functor. If you first assign the return value of %std::bind()
    * to a std::function, you can connect the std::function to a signal.
    *
+   * If slots with a priority have been connected, the slot is added after
+   * the slots with priority 0 or higher. See connect(const slot_type& slot_, int priority).
+   *
    * @param slot_ The slot to add to the list of slots.
    * @return A connection.
    */
@@ -428,6 +572,11 @@ public:
 
   /** Add a slot at the end of the list of slots.
    * @see connect(const slot_type& slot_).
+   * A slot that's not connected to another signal is moved, not copied,
+   * so its functor may be move-only:
+   * @code
+   * sig.connect([buffer = std::make_unique<Buffer>()](int i) { buffer->append(i); });
+   * @endcode
    *
    * @newin{2,8}
    */
@@ -438,6 +587,42 @@ public:
     return connection(slot_base);
   }
 
+  /** Add a slot with a priority.
+   * Slots with a higher priority are invoked before slots with a lower
+   * priority. Slots with the same priority are invoked in the order in
+   * which they have been connected. connect(const slot_type& slot_) and
+   * connect_first() connect slots with priority 0.
+   *
+   * The position of the new slot is found in logarithmic time in the number
+   * of distinct priorities. Named groups can be given fixed priorities,
+   * e.g. with an enumeration:
+   * @code
+   * enum Stage { Intercept = 100, Log = 50 };
+   * sig.connect(sigc::ptr_fun(&log), Log);
+   * sig.connect(sigc::ptr_fun(&intercept), Intercept); // Invoked first.
+   * @endcode
+   *
+   * @param slot_ The slot to add to the list of slots.
+   * @param priority The priority of the slot.
+   * @return A connection.
+   */
+  connection connect(const slot_type& slot_, int priority)
+  {
+    auto iter = signal_base::connect(slot_, priority);
+    auto& slot_base = *iter;
+    return connection(slot_base);
+  }
+
+  /** Add a slot with a priority.
+   * @see connect(const slot_type& slot_, int priority).
+   */
+  connection connect(slot_type&& slot_, int priority)
+  {
+    auto iter = signal_base::connect(std::move(slot_), priority);
+    auto& slot_base = *iter;
+    return connection(slot_base);
+  }
+
   /** Add a slot at the beginning of the list of slots.
    * Any functor or slot may be passed into %connect_first().
    * It will be converted into a slot implicitly.
@@ -453,6 +638,9 @@ public:
    * of such a functor. If you first assign the return value of %std::bind()
    * to a std::function, you can connect the std::function to a signal.
    *
+   * If slots with a priority have been connected, the slot is added before
+   * the slots with priority 0 or lower.
+   *
    * @param slot_ The slot to add to the list of slots.
    * @return A connection.
    *
@@ -499,6 +687,144 @@ public:
     return emit(std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
+  /** Triggers the emission of the signal, moving the arguments into the last slot.
+   * Like emit(), but the arguments of class types that are passed by value,
+   * such as a std::string or a std::vector, must be rvalues. The last slot
+   * that is invoked gets them as rvalues, and can take them over without
+   * copying them. The other slots get const references to them, as in emit().
+   * Thus only the last slot should move from an argument:
+   * @code
+   * sigc::signal<void(std::vector<Sample>)> sig;
+   * sig.connect(sigc::mem_fun(monitor, &Monitor::inspect)); // inspect(const std::vector<Sample>&)
+   * sig.connect(sigc::mem_fun(store, &Store::take)); // take(std::vector<Sample>)
+   * sig.emit_move(read_samples()); // The samples are not copied.
+   * @endcode
+   * A slot gets the moved arguments if no slot after it is going to be
+   * invoked when it's invoked. If it unblocks a following slot, that slot gets
+   * const references to what's left of the arguments.
+   *
+   * If a slot's functor can't take the moved arguments, e.g. because it takes
+   * them by non-const reference, or if it's an adaptor such as the functors
+   * that sigc::bind() and sigc::hide() return, it gets const references
+   * instead. Arguments of rvalue reference types are passed on like in emit().
+   * emit_move() is only available if @e T_accumulator is @p void.
+   *
+   * @param a Arguments to be passed on to the slots.
+   * @return The return value of the last slot invoked.
+   */
+  decltype(auto) emit_move(type_trait_take_moving_t<T_arg>... a) const
+  {
+    static_assert(std::is_void_v<T_accumulator>,
+      "emit_move() can't be used with an accumulator, which decides which slots are invoked.");
+    using emitter_type = internal::signal_emit_move<T_return, T_arg...>;
+    return emitter_type::emit(impl_, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+  }
+
+  /** Triggers the emission of the signal, invoking the slots in parallel.
+   * The slots that are not blocked are invoked by the threads of @a pool and by
+   * the calling thread. This function returns when all of them have finished.
+   * Their return values are combined with @a combine, in the order of the slots,
+   * but not one after the other. Therefore @a combine must be associative:
+   * combine(combine(x, y), z) == combine(x, combine(y, z)).
+   * Each task of the pool uses its own copy of @a combine, so it's not called
+   * concurrently, unless its copies share state, e.g. through a reference.
+   * The accumulator @e T_accumulator is not used.
+   *
+   * The slots must be safe to invoke concurrently. They must not connect or
+   * disconnect slots of this signal. Include <sigc++/thread_pool.h> to use
+   * this function.
+   *
+   * @par Example:
+   * @code
+   * sigc::thread_pool pool;
+   * int n_failed = sig.emit_parallel(pool, 0, std::plus<int>(), data);
+   * @endcode
+   *
+   * @param pool The threads that invoke the slots.
+   * @param init The value that the return values are combined with.
+   *             It's returned if no slot is invoked.
+   * @param combine Associative function that combines two values.
+   * @param a Arguments to be passed on to the slots.
+   * @return The combined return values of the slot invocations.
+   */
+  template<typename T_value, typename T_combiner>
+  T_value emit_parallel(
+    thread_pool& pool, T_value init, T_combiner combine, type_trait_take_t<T_arg>... a) const
+  {
+    using emitter_type = internal::signal_emit_parallel<T_return, T_arg...>;
+    return emitter_type::emit(pool, impl_, std::move(init), combine, a...);
+  }
+
+  /** Triggers the emission of the signal, invoking the slots in parallel.
+   * Like emit_parallel(thread_pool&, T_value, T_combiner, type_trait_take_t<T_arg>...),
+   * but the return values of the slots are discarded.
+   *
+   * @param pool The threads that invoke the slots.
+   * @param a Arguments to be passed on to the slots.
+   */
+  void emit_parallel(thread_pool& pool, type_trait_take_t<T_arg>... a) const
+  {
+    using emitter_type = internal::signal_emit_parallel<T_return, T_arg...>;
+    emitter_type::emit(pool, impl_, a...);
+  }
+
+  /** Triggers the emission of the signal, for slots that return awaitables.
+   * The slots are invoked like in emit(). Each of them returns an awaitable,
+   * e.g. a coroutine task, and all of them are awaited concurrently. The
+   * returned awaitable completes when all of them have completed:
+   * @code
+   * sigc::signal<task<int>(request)> sig;
+   * std::vector<int> results = co_await sig.emit_async(req);
+   * @endcode
+   * The results of the slots are passed to the accumulator in the order in
+   * which the slots have completed. If @e T_accumulator is @p void, the
+   * result of co_await is a std::vector of the results, in that order.
+   *
+   * All slots are invoked before emit_async() returns, and the accumulator
+   * is only called when the last one has completed. So an accumulator that
+   * stops at a certain result can't keep the other slots from running, and
+   * it doesn't shorten the time until co_await returns. It only chooses
+   * which results to use.
+   *
+   * If some slots throw exceptions, one of them is rethrown by co_await,
+   * after all slots have completed.
+   *
+   * Include <sigc++/awaitable.h> to use this function. It's only available
+   * if SIGC_HAVE_COROUTINES is defined.
+   *
+   * @param a Arguments to be passed on to the slots.
+   * @return An awaitable whose result is the accumulated result of the slots.
+   */
+  internal::signal_emit_async<T_return, T_accumulator, T_arg...> emit_async(
+    type_trait_take_t<T_arg>... a) const
+  {
+    return internal::signal_emit_async<T_return, T_accumulator, T_arg...>(
+      impl_, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Returns an awaitable that completes with the next emission of the signal.
+   * A C++20 coroutine that awaits it is suspended until the signal is emitted,
+   * and is then resumed with a std::tuple of the arguments, before the
+   * emission continues with the following slots:
+   * @code
+   * auto [id, text] = co_await sig.next();
+   * @endcode
+   * A one-shot slot is connected while the coroutine is suspended. It's
+   * disconnected when it has fired, or when the coroutine is destroyed.
+   * If the signal is destroyed or cleared first, the coroutine is not resumed.
+   * The one-shot slot is connected at the end of the list of slots. If
+   * @e T_return is not @p void, it returns a default-constructed value.
+   *
+   * Include <sigc++/awaitable.h> to use this function. It's only available
+   * if SIGC_HAVE_COROUTINES is defined.
+   *
+   * @return An awaitable whose result is a std::tuple of the decayed argument types.
+   */
+  internal::signal_next_awaiter<T_return, T_arg...> next() const
+  {
+    return internal::signal_next_awaiter<T_return, T_arg...>(impl());
+  }
+
   /** Creates a functor that calls emit() on this signal.
    *
    * @note %sigc::signal does not derive from sigc::trackable.
@@ -525,6 +851,23 @@ public:
 
   signal_with_accumulator() = default;
 
+  /** Constructs a signal whose list of slots is allocated from @a resource.
+   * The slots that are connected to the signal are copied into memory from
+   * @a resource, unless they have been allocated from it already.
+   * See also the slot constructor that takes a std::pmr::memory_resource.
+   *
+   * @par Example:
+   * @code
+   * std::pmr::unsynchronized_pool_resource pool;
+   * sigc::signal<void(int)> sig(&pool);
+   * sig.connect(sigc::ptr_fun(&on_value));
+   * @endcode
+   *
+   * @param resource The memory resource. It must outlive the signal,
+   *                 its copies, and its connected slots.
+   */
+  explicit signal_with_accumulator(std::pmr::memory_resource* resource) : signal_base(resource) {}
+
   signal_with_accumulator(const signal_with_accumulator& src) : signal_base(src) {}
 
   signal_with_accumulator(signal_with_accumulator&& src) : signal_base(std::move(src)) {}
@@ -648,6 +991,15 @@ public:
 
   signal() = default;
 
+  /** Constructs a signal whose list of slots is allocated from @a resource.
+   * See signal_with_accumulator(std::pmr::memory_resource*).
+   * @param resource The memory resource.
+   */
+  explicit signal(std::pmr::memory_resource* resource)
+  : signal_with_accumulator<T_return, accumulator_type, T_arg...>(resource)
+  {
+  }
+
   signal(const signal& src) : signal_with_accumulator<T_return, accumulator_type, T_arg...>(src) {}
 
   signal(signal&& src)
@@ -721,6 +1073,9 @@ public:
    * of such a functor. If you first assign the return value of %std::bind()
    * to a std::function, you can connect the std::function to a signal.
    *
+   * If slots with a priority have been connected, the slot is added after
+   * the slots with priority 0 or higher. See connect(const slot_type& slot_, int priority).
+   *
    * @param slot_ The slot to add to the list of slots.
    * @return A connection.
    */
@@ -733,6 +1088,11 @@ public:
 
   /** Add a slot at the end of the list of slots.
    * @see connect(const slot_type& slot_).
+   * A slot that's not connected to another signal is moved, not copied,
+   * so its functor may be move-only:
+   * @code
+   * sig.connect([buffer = std::make_unique<Buffer>()](int i) { buffer->append(i); });
+   * @endcode
    */
   connection connect(slot_type&& slot_)
   {
@@ -741,6 +1101,29 @@ public:
     return connection(slot_base);
   }
 
+  /** Add a slot with a priority.
+   * See signal_with_accumulator::connect(const slot_type& slot_, int priority).
+   * @param slot_ The slot to add to the list of slots.
+   * @param priority The priority of the slot.
+   * @return A connection.
+   */
+  connection connect(const slot_type& slot_, int priority)
+  {
+    auto iter = signal_base::connect(slot_, priority);
+    auto& slot_base = *iter;
+    return connection(slot_base);
+  }
+
+  /** Add a slot with a priority.
+   * @see connect(const slot_type& slot_, int priority).
+   */
+  connection connect(slot_type&& slot_, int priority)
+  {
+    auto iter = signal_base::connect(std::move(slot_), priority);
+    auto& slot_base = *iter;
+    return connection(slot_base);
+  }
+
   /** Add a slot at the beginning of the list of slots.
    * Any functor or slot may be passed into %connect_first().
    * It will be converted into a slot implicitly.
@@ -756,6 +1139,9 @@ public:
    * of such a functor. If you first assign the return value of %std::bind()
    * to a std::function, you can connect the std::function to a signal.
    *
+   * If slots with a priority have been connected, the slot is added before
+   * the slots with priority 0 or lower.
+   *
    * @param slot_ The slot to add to the list of slots.
    * @return A connection.
    *
@@ -802,6 +1188,71 @@ public:
     return emit(std::forward<type_trait_take_t<T_arg>>(a)...);
   }
 
+  /** Triggers the emission of the signal, moving the arguments into the last slot.
+   * See signal_with_accumulator::emit_move().
+   * @param a Arguments to be passed on to the slots.
+   * @return The return value of the last slot invoked.
+   */
+  decltype(auto) emit_move(type_trait_take_moving_t<T_arg>... a) const
+  {
+    static_assert(std::is_void_v<T_accumulator>,
+      "emit_move() can't be used with an accumulator, which decides which slots are invoked.");
+    using emitter_type = internal::signal_emit_move<T_return, T_arg...>;
+    return emitter_type::emit(impl_, std::forward<type_trait_take_moving_t<T_arg>>(a)...);
+  }
+
+  /** Triggers the emission of the signal, invoking the slots in parallel.
+   * See signal_with_accumulator::emit_parallel(). Include
+   * <sigc++/thread_pool.h> to use this function.
+   * @param pool The threads that invoke the slots.
+   * @param init The value that the return values are combined with.
+   * @param combine Associative function that combines two values.
+   * @param a Arguments to be passed on to the slots.
+   * @return The combined return values of the slot invocations.
+   */
+  template<typename T_value, typename T_combiner>
+  T_value emit_parallel(
+    thread_pool& pool, T_value init, T_combiner combine, type_trait_take_t<T_arg>... a) const
+  {
+    using emitter_type = internal::signal_emit_parallel<T_return, T_arg...>;
+    return emitter_type::emit(pool, impl_, std::move(init), combine, a...);
+  }
+
+  /** Triggers the emission of the signal, invoking the slots in parallel.
+   * The return values of the slots are discarded.
+   * See signal_with_accumulator::emit_parallel().
+   * @param pool The threads that invoke the slots.
+   * @param a Arguments to be passed on to the slots.
+   */
+  void emit_parallel(thread_pool& pool, type_trait_take_t<T_arg>... a) const
+  {
+    using emitter_type = internal::signal_emit_parallel<T_return, T_arg...>;
+    emitter_type::emit(pool, impl_, a...);
+  }
+
+  /** Triggers the emission of the signal, for slots that return awaitables.
+   * See signal_with_accumulator::emit_async(). Include <sigc++/awaitable.h>
+   * to use this function.
+   * @param a Arguments to be passed on to the slots.
+   * @return An awaitable whose result is the accumulated result of the slots.
+   */
+  internal::signal_emit_async<T_return, T_accumulator, T_arg...> emit_async(
+    type_trait_take_t<T_arg>... a) const
+  {
+    return internal::signal_emit_async<T_return, T_accumulator, T_arg...>(
+      impl_, std::forward<type_trait_take_t<T_arg>>(a)...);
+  }
+
+  /** Returns an awaitable that completes with the next emission of the signal.
+   * See signal_with_accumulator::next(). Include <sigc++/awaitable.h> to use
+   * this function.
+   * @return An awaitable whose result is a std::tuple of the decayed argument types.
+   */
+  internal::signal_next_awaiter<T_return, T_arg...> next() const
+  {
+    return internal::signal_next_awaiter<T_return, T_arg...>(impl());
+  }
+
   /** Creates a functor that calls emit() on this signal.
    *
    * @code
@@ -16,29 +16,485 @@
  *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
  */
 #include <sigc++/signal_base.h>
-#include <memory> // std::unique_ptr
+#include <algorithm> // std::min
+#include <memory>
+#include <new>
 
 namespace sigc
 {
 namespace internal
 {
 
-// Data sent from signal_impl::insert() to slot_rep::set_parent() when a slot is
-// connected, and then sent from slot_rep::disconnect() to
-// signal_impl::notify_self_and_iter_of_invalidated_slot()
-// when the slot is disconnected. Bug 167714.
-struct self_and_iter : public notifiable
+// Header of a block of nodes allocated by chunked_slot_list.
+// The nodes follow the header in the same allocation.
+struct chunked_slot_list::chunk
+{
+  chunk* next_;
+  size_type capacity_;
+
+  static constexpr size_type min_capacity = 4;
+  static constexpr size_type max_capacity = 64;
+
+  slot_list_node* nodes() noexcept { return reinterpret_cast<slot_list_node*>(this + 1); }
+};
+
+chunked_slot_list::chunked_slot_list() noexcept : chunked_slot_list(nullptr) {}
+
+chunked_slot_list::chunked_slot_list(std::pmr::memory_resource* resource) noexcept
+: head_{ &head_, &head_ },
+  size_(0),
+  free_(nullptr),
+  chunks_(nullptr),
+  resource_(resource),
+  groups_(resource ? resource : std::pmr::new_delete_resource()),
+  markers_(0),
+  pending_(0),
+  inline_node_used_(false)
+{
+}
+
+chunked_slot_list::~chunked_slot_list()
+{
+  clear();
+}
+
+void*
+chunked_slot_list::allocate_node()
 {
-  const std::weak_ptr<signal_impl> self_;
-  const signal_impl::iterator_type iter_;
+  static_assert(sizeof(chunk) % alignof(slot_list_node) == 0,
+    "The nodes that follow a chunk header would be misaligned.");
 
-  self_and_iter(const std::weak_ptr<signal_impl>& self, const signal_impl::iterator_type& iter)
-  : self_(self), iter_(iter)
+  if (!inline_node_used_)
   {
+    inline_node_used_ = true;
+    return inline_node_;
   }
-};
 
-signal_impl::signal_impl() : exec_count_(0), deferred_(false) {}
+  if (!free_)
+  {
+    // Each new chunk is twice as large as the previous one, up to a limit.
+    const size_type capacity =
+      chunks_ ? std::min(2 * chunks_->capacity_, chunk::max_capacity) : chunk::min_capacity;
+    const auto bytes = sizeof(chunk) + capacity * sizeof(slot_list_node);
+    auto c = static_cast<chunk*>(
+      resource_ ? resource_->allocate(bytes, alignof(chunk)) : ::operator new(bytes));
+    c->next_ = chunks_;
+    c->capacity_ = capacity;
+    chunks_ = c;
+
+    // Thread the free list so that nodes are handed out in address order.
+    auto nodes = c->nodes();
+    for (size_type n = capacity; n-- > 0;)
+    {
+      auto link = static_cast<slot_list_link*>(&nodes[n]);
+      link->next_ = free_;
+      free_ = link;
+    }
+  }
+
+  auto p = free_;
+  free_ = p->next_;
+  return p;
+}
+
+void
+chunked_slot_list::deallocate_node(void* p) noexcept
+{
+  if (p == inline_node_)
+  {
+    inline_node_used_ = false;
+    return;
+  }
+
+  auto link = static_cast<slot_list_link*>(p);
+  link->next_ = free_;
+  free_ = link;
+}
+
+// static
+chunked_slot_list::iterator
+chunked_slot_list::link_node(iterator i, slot_list_node* node) noexcept
+{
+  auto next = i.link_;
+  node->prev_ = next->prev_;
+  node->next_ = next;
+  next->prev_->next_ = node;
+  next->prev_ = node;
+  return iterator(node);
+}
+
+// static
+void
+chunked_slot_list::unlink_node(slot_list_node* node) noexcept
+{
+  node->prev_->next_ = node->next_;
+  node->next_->prev_ = node->prev_;
+}
+
+bool
+chunked_slot_list::needs_copy(const slot_base& slot) const noexcept
+{
+  return resource_ && slot.rep_ && slot.rep_->resource() != resource_;
+}
+
+// A slot_rep with a parent can't be shared. If the slot that's inserted
+// could share its slot_rep, copying the slot_rep right away is cheaper than
+// sharing it first and unsharing it in slot_base::set_parent().
+// static
+bool
+chunked_slot_list::is_shareable(const slot_base& slot) noexcept
+{
+  return slot.rep_ && slot.rep_->shareable();
+}
+
+slot_base
+chunked_slot_list::copy_rep(const slot_base& slot) const
+{
+  slot_base copy(resource_ ? slot.rep_->clone_in(resource_) : slot.rep_->clone());
+  copy.block(slot.blocked());
+  return copy;
+}
+
+template<typename T_slot>
+chunked_slot_list::iterator
+chunked_slot_list::insert_node(iterator i, T_slot&& slot, int priority, bool pending)
+{
+  const auto group = reserve_group(priority);
+  void* p = nullptr;
+  slot_list_node* node = nullptr;
+  try
+  {
+    p = allocate_node();
+    node = new (p) slot_list_node(std::forward<T_slot>(slot));
+  }
+  catch (...)
+  {
+    if (p)
+      deallocate_node(p);
+    unreserve_group(group);
+    throw;
+  }
+  node->priority_ = priority;
+  ++size_;
+  auto iter = link_node(i, node);
+  if (pending)
+  {
+    // The node is moved into the group by place_pending().
+    node->pending_ = true;
+    ++pending_;
+    if (group != groups_.end())
+      ++group->second.pending_;
+  }
+  else
+    add_to_group(group, node);
+  return iter;
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::insert(iterator i, const slot_base& slot, int priority)
+{
+  if (needs_copy(slot) || is_shareable(slot))
+    return insert(i, copy_rep(slot), priority);
+  return insert_node(i, slot, priority, false);
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::insert(iterator i, slot_base&& slot, int priority)
+{
+  if (needs_copy(slot))
+    return insert(i, copy_rep(slot), priority);
+  return insert_node(i, std::move(slot), priority, false);
+}
+
+template<typename T_slot>
+chunked_slot_list::iterator
+chunked_slot_list::insert_into_group_impl(group_position position, T_slot&& slot, int priority)
+{
+  // Without groups, the new slot can't be inserted before a marker.
+  if (markers_ == 0 || groups_.empty())
+  {
+    const auto i =
+      position == group_position::begin ? group_begin(priority) : group_end(priority);
+    return insert_node(i, std::forward<T_slot>(slot), priority, false);
+  }
+
+  auto iter = insert_node(end(), std::forward<T_slot>(slot), priority, true);
+  static_cast<slot_list_node*>(iter.link_)->pending_at_begin_ = position == group_position::begin;
+  return iter;
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::insert_into_group(group_position position, const slot_base& slot, int priority)
+{
+  if (needs_copy(slot) || is_shareable(slot))
+    return insert_into_group(position, copy_rep(slot), priority);
+  return insert_into_group_impl(position, slot, priority);
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::insert_into_group(group_position position, slot_base&& slot, int priority)
+{
+  if (needs_copy(slot))
+    return insert_into_group(position, copy_rep(slot), priority);
+  return insert_into_group_impl(position, std::move(slot), priority);
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::after(slot_list_node* node) noexcept
+{
+  auto link = node->next_;
+  while (link != &head_ && static_cast<slot_list_node*>(link)->marker_)
+    link = link->next_;
+  return iterator(link);
+}
+
+chunked_slot_list::group_map::iterator
+chunked_slot_list::higher_group(int priority) noexcept
+{
+  // Skip the groups whose slots are all pending.
+  auto group = groups_.upper_bound(priority);
+  while (group != groups_.end() && !group->second.first_)
+    ++group;
+  return group;
+}
+
+chunked_slot_list::group_map::iterator
+chunked_slot_list::lower_group(int priority) noexcept
+{
+  auto group = groups_.lower_bound(priority);
+  while (group != groups_.begin())
+  {
+    --group;
+    if (group->second.first_)
+      return group;
+  }
+  return groups_.end();
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::group_begin(int priority) noexcept
+{
+  if (groups_.empty())
+    return priority < 0 ? end() : begin();
+
+  auto group = groups_.find(priority);
+  if (group != groups_.end() && group->second.first_)
+    return iterator(group->second.first_);
+  if (priority != 0)
+    return group_end(priority); // The group is empty.
+
+  // Append to the closest group with a higher priority.
+  group = higher_group(0);
+  return group != groups_.end() ? after(group->second.last_) : begin();
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::group_end(int priority) noexcept
+{
+  if (groups_.empty())
+    return priority > 0 ? begin() : end();
+
+  // The groups with a higher priority precede the group, the others follow it.
+  // The group with priority 0 is not in groups_.
+  const auto group = groups_.find(priority);
+  if (group != groups_.end() && group->second.first_)
+    return after(group->second.last_);
+
+  if (priority > 0)
+  {
+    // Append to the closest group with a higher priority.
+    const auto higher = higher_group(priority);
+    return higher != groups_.end() ? after(higher->second.last_) : begin();
+  }
+
+  // Prepend to the closest group with a lower priority.
+  const auto lower = lower_group(priority);
+  return lower != groups_.end() ? iterator(lower->second.first_) : end();
+}
+
+chunked_slot_list::group_map::iterator
+chunked_slot_list::reserve_group(int priority)
+{
+  if (priority == 0)
+    return groups_.end();
+  return groups_.try_emplace(priority, group_bounds{ nullptr, nullptr, 0 }).first;
+}
+
+void
+chunked_slot_list::unreserve_group(group_map::iterator group) noexcept
+{
+  if (group != groups_.end() && !group->second.first_ && !group->second.pending_)
+    groups_.erase(group);
+}
+
+void
+chunked_slot_list::add_to_group(group_map::iterator group, slot_list_node* node) noexcept
+{
+  if (group == groups_.end())
+    return;
+
+  auto& bounds = group->second;
+  if (!bounds.first_)
+    bounds.first_ = bounds.last_ = node;
+  else if (node->next_ == bounds.first_)
+    bounds.first_ = node;
+  else
+    bounds.last_ = node;
+}
+
+void
+chunked_slot_list::remove_from_group(slot_list_node* node) noexcept
+{
+  const auto group = groups_.find(node->priority_);
+  auto& bounds = group->second;
+  if (bounds.first_ == node && bounds.last_ == node)
+  {
+    if (bounds.pending_)
+      bounds.first_ = bounds.last_ = nullptr;
+    else
+      groups_.erase(group);
+    return;
+  }
+
+  // The group's other slots are adjacent, apart from markers.
+  const auto priority = node->priority_;
+  if (bounds.first_ == node)
+  {
+    auto link = node->next_;
+    while (static_cast<slot_list_node*>(link)->priority_ != priority)
+      link = link->next_;
+    bounds.first_ = static_cast<slot_list_node*>(link);
+  }
+  else if (bounds.last_ == node)
+  {
+    auto link = node->prev_;
+    while (static_cast<slot_list_node*>(link)->priority_ != priority)
+      link = link->prev_;
+    bounds.last_ = static_cast<slot_list_node*>(link);
+  }
+}
+
+void
+chunked_slot_list::remove_pending(slot_list_node* node) noexcept
+{
+  node->pending_ = false;
+  --pending_;
+  if (node->priority_ == 0)
+    return;
+
+  const auto group = groups_.find(node->priority_);
+  --group->second.pending_;
+  unreserve_group(group);
+}
+
+void
+chunked_slot_list::place_pending() noexcept
+{
+  // The pending nodes follow all other nodes. Find the first one.
+  auto link = head_.prev_;
+  slot_list_link* first = nullptr;
+  for (auto n = pending_; n > 0; link = link->prev_)
+  {
+    if (static_cast<slot_list_node*>(link)->pending_)
+    {
+      first = link;
+      --n;
+    }
+  }
+
+  // Move them into their groups in the order in which they have been inserted.
+  // A node that's moved behind the others is not visited again, because it's
+  // no longer pending.
+  link = first;
+  while (pending_ > 0)
+  {
+    auto node = static_cast<slot_list_node*>(link);
+    link = link->next_;
+    if (!node->pending_)
+      continue;
+
+    const auto priority = node->priority_;
+    const auto group = priority != 0 ? groups_.find(priority) : groups_.end();
+    node->pending_ = false;
+    --pending_;
+    if (group != groups_.end())
+      --group->second.pending_;
+
+    unlink_node(node);
+    link_node(node->pending_at_begin_ ? group_begin(priority) : group_end(priority), node);
+    add_to_group(group, node);
+  }
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::erase(iterator i)
+{
+  auto node = static_cast<slot_list_node*>(i.link_);
+  iterator next(node->next_);
+
+  // Unlink the node before the slot is destroyed. The destruction of the slot
+  // may lead to other modifications of the list.
+  if (node->pending_)
+    remove_pending(node);
+  else if (node->priority_ != 0)
+    remove_from_group(node);
+  unlink_node(node);
+  --size_;
+
+  node->~slot_list_node();
+  deallocate_node(node);
+  return next;
+}
+
+void
+chunked_slot_list::clear()
+{
+  while (!empty())
+    erase(begin());
+
+  // The destruction of a slot may have connected new slots.
+  if (empty())
+    release_chunks();
+}
+
+chunked_slot_list::iterator
+chunked_slot_list::link_marker(iterator i, slot_list_node& marker) noexcept
+{
+  marker.marker_ = true;
+  ++markers_;
+  return link_node(i, &marker);
+}
+
+void
+chunked_slot_list::unlink_marker(slot_list_node& marker) noexcept
+{
+  unlink_node(&marker);
+  if (--markers_ == 0 && pending_ > 0)
+    place_pending();
+}
+
+void
+chunked_slot_list::release_chunks() noexcept
+{
+  while (chunks_)
+  {
+    auto c = chunks_;
+    chunks_ = c->next_;
+    if (resource_)
+      resource_->deallocate(
+        c, sizeof(chunk) + c->capacity_ * sizeof(slot_list_node), alignof(chunk));
+    else
+      ::operator delete(c);
+  }
+  free_ = nullptr;
+}
+
+signal_impl::signal_impl() : exec_count_(0), deferred_(false), destroy_pending_(false) {}
+
+signal_impl::signal_impl(std::pmr::memory_resource* resource) noexcept
+: slots_(resource), exec_count_(0), deferred_(false), destroy_pending_(false)
+{
+}
 
 signal_impl::~signal_impl()
 {
@@ -61,26 +517,83 @@ signal_impl::operator delete(void* p)
 }
 #endif
 
+// static
+void
+signal_impl::destroy(signal_impl* impl)
+{
+  if (impl->exec_count_ > 0)
+  {
+    // A slot has deleted the last signal that refers to impl.
+    // impl is deleted by release_exec(), when the emission has finished.
+    impl->destroy_pending_ = true;
+    return;
+  }
+
+  dispose(impl);
+}
+
+// static
+std::shared_ptr<signal_impl>
+signal_impl::create(std::pmr::memory_resource* resource)
+{
+  if (!resource)
+    return std::shared_ptr<signal_impl>(new signal_impl, &signal_impl::destroy);
+
+  auto p = resource->allocate(sizeof(signal_impl), alignof(signal_impl));
+  auto impl = new (p) signal_impl(resource);
+
+  // If the control block can't be allocated, the shared_ptr constructor calls destroy().
+  return std::shared_ptr<signal_impl>(
+    impl, &signal_impl::destroy, std::pmr::polymorphic_allocator<signal_impl>(resource));
+}
+
+// static
+void
+signal_impl::dispose(signal_impl* impl) noexcept
+{
+  const auto resource = impl->resource();
+  if (!resource)
+  {
+    delete impl;
+    return;
+  }
+
+  impl->~signal_impl();
+  resource->deallocate(impl, sizeof(signal_impl), alignof(signal_impl));
+}
+
+void
+signal_impl::release_exec()
+{
+  if (destroy_pending_)
+  {
+    // The destructor calls clear(), which takes the execution counter again.
+    destroy_pending_ = false;
+    dispose(this);
+    return;
+  }
+
+  // The deletion of a slot in sweep() may lead to destroy() and the
+  // deletion of this, when sweep() releases the execution counter.
+  sweep();
+}
+
 void
 signal_impl::clear()
 {
   // Don't let signal_impl::notify_self_and_iter_of_invalidated_slot() erase the slots.
   // It would invalidate the iterator in the following loop.
-  // Don't call shared_from_this() here. clear() is called from the destructor.
-  // When the destructor is executing, shared_ptr's use_count has reached 0,
-  // and it's no longer possible to get a shared_ptr to this.
   const bool during_signal_emission = exec_count_ > 0;
   const bool saved_deferred = deferred_;
   signal_impl_exec_holder exec(this);
 
   // Disconnect all connected slots before they are deleted.
-  // signal_impl::notify_self_and_iter_of_invalidated_slot() will be called and
-  // delete the self_and_iter structs.
+  // signal_impl::notify_self_and_iter_of_invalidated_slot() will be called.
   for (auto& slot : slots_)
     slot.disconnect();
 
   // Don't clear slots_ during signal emission. Provided deferred_ is true,
-  // sweep() will be called from ~signal_impl_holder() after signal emission,
+  // sweep() will be called from ~signal_impl_exec_holder() after signal emission,
   // and it will erase all disconnected slots.
   // https://bugzilla.gnome.org/show_bug.cgi?id=784550
   if (!during_signal_emission)
@@ -99,7 +612,7 @@ signal_impl::size() const noexcept
 bool
 signal_impl::blocked() const noexcept
 {
-  for (const auto& slot : const_cast<const std::list<slot_base>&>(slots_))
+  for (const auto& slot : const_cast<const slot_list&>(slots_))
   {
     if (!slot.blocked())
       return false;
@@ -119,32 +632,64 @@ signal_impl::block(bool should_block) noexcept
 signal_impl::iterator_type
 signal_impl::connect(const slot_base& slot_)
 {
-  return insert(slots_.end(), slot_);
+  auto iter = slots_.insert_into_group(chunked_slot_list::group_position::end, slot_, 0);
+  add_notification_to_iter(iter);
+  return iter;
 }
 
 signal_impl::iterator_type
 signal_impl::connect(slot_base&& slot_)
 {
-  return insert(slots_.end(), std::move(slot_));
+  auto iter = slots_.insert_into_group(
+    chunked_slot_list::group_position::end, std::move(slot_), 0);
+  add_notification_to_iter(iter);
+  return iter;
+}
+
+signal_impl::iterator_type
+signal_impl::connect(const slot_base& slot_, int priority)
+{
+  auto iter = slots_.insert_into_group(chunked_slot_list::group_position::end, slot_, priority);
+  add_notification_to_iter(iter);
+  return iter;
+}
+
+signal_impl::iterator_type
+signal_impl::connect(slot_base&& slot_, int priority)
+{
+  auto iter = slots_.insert_into_group(
+    chunked_slot_list::group_position::end, std::move(slot_), priority);
+  add_notification_to_iter(iter);
+  return iter;
 }
 
 signal_impl::iterator_type
 signal_impl::connect_first(const slot_base& slot_)
 {
-  return insert(slots_.begin(), slot_);
+  auto iter = slots_.insert_into_group(chunked_slot_list::group_position::begin, slot_, 0);
+  add_notification_to_iter(iter);
+  return iter;
 }
 
 signal_impl::iterator_type
 signal_impl::connect_first(slot_base&& slot_)
 {
-  return insert(slots_.begin(), std::move(slot_));
+  auto iter = slots_.insert_into_group(
+    chunked_slot_list::group_position::begin, std::move(slot_), 0);
+  add_notification_to_iter(iter);
+  return iter;
 }
 
+// The slot_list_node is sent from signal_impl::insert() to slot_rep::set_parent()
+// when a slot is connected, and then sent from slot_rep::disconnect() to
+// signal_impl::notify_self_and_iter_of_invalidated_slot()
+// when the slot is disconnected. Bug 167714.
 void
-signal_impl::add_notification_to_iter(const signal_impl::iterator_type& iter)
+signal_impl::add_notification_to_iter(const signal_impl::iterator_type& iter) noexcept
 {
-  auto si = new self_and_iter(shared_from_this(), iter);
-  iter->set_parent(si, &signal_impl::notify_self_and_iter_of_invalidated_slot);
+  auto node = static_cast<slot_list_node*>(iter.link_);
+  node->owner_ = this;
+  iter->set_parent(node, &signal_impl::notify_self_and_iter_of_invalidated_slot);
 }
 
 signal_impl::iterator_type
@@ -167,10 +712,12 @@ void
 signal_impl::sweep()
 {
   // The deletion of a slot may cause the deletion of a signal_base,
-  // a decrementation of ref_count_, and the deletion of this.
-  // In that case, the deletion of this is deferred to ~signal_impl_holder().
-  signal_impl_holder exec(shared_from_this());
+  // and a call to destroy(). In that case, the deletion of this is deferred
+  // to ~signal_impl_exec_holder().
+  signal_impl_exec_holder exec(this);
 
+  // sweep() is not called during signal emission, so the list contains no
+  // temp_slot_list marker that must not be erased.
   deferred_ = false;
   auto i = slots_.begin();
   while (i != slots_.end())
@@ -182,32 +729,38 @@ signal_impl::sweep()
   }
 }
 
+// static
+signal_impl*
+signal_impl::owner(const slot_base& slot) noexcept
+{
+  const auto rep = slot.rep_;
+  if (!rep || rep->cleanup_ != &signal_impl::notify_self_and_iter_of_invalidated_slot)
+    return nullptr;
+  return static_cast<slot_list_node*>(rep->parent_)->owner_;
+}
+
 // static
 void
 signal_impl::notify_self_and_iter_of_invalidated_slot(notifiable* d)
 {
-  std::unique_ptr<self_and_iter> si(static_cast<self_and_iter*>(d));
-  auto self = si->self_.lock();
-  if (!self)
-  {
-    // The signal_impl object is being deleted. The use_count has reached 0.
-    // Nothing to do here. exec_count_ > 0 and clear() will restore deferred_.
-    return;
-  }
+  // The node is owned by self, so self is alive. If self is being deleted,
+  // exec_count_ > 0 and clear() will restore deferred_.
+  auto node = static_cast<slot_list_node*>(d);
+  auto self = node->owner_;
 
   if (self->exec_count_ == 0)
   {
     // The deletion of a slot may cause the deletion of a signal_base,
-    // a decrementation of si->self_->ref_count_, and the deletion of si->self_.
-    // In that case, the deletion of si->self_ is deferred to ~signal_impl_holder().
+    // and a call to destroy(). In that case, the deletion of self is
+    // deferred to ~signal_impl_exec_holder().
     // https://bugzilla.gnome.org/show_bug.cgi?id=564005#c24
-    signal_impl_holder exec(self);
-    self->slots_.erase(si->iter_);
+    signal_impl_exec_holder exec(self);
+    self->slots_.erase(iterator_type(node));
   }
   else
   {
     // This is occurring during signal emission or slot erasure.
-    // => sweep() will be called from ~signal_impl_holder() after signal emission.
+    // => sweep() will be called from ~signal_impl_exec_holder() after signal emission.
     // This is safer because we don't have to care about our
     // iterators in emit() and clear().
     self->deferred_ = true;
@@ -218,6 +771,11 @@ signal_impl::notify_self_and_iter_of_invalidated_slot(notifiable* d)
 
 signal_base::signal_base() noexcept {}
 
+signal_base::signal_base(std::pmr::memory_resource* resource)
+: impl_(internal::signal_impl::create(resource))
+{
+}
+
 signal_base::signal_base(const signal_base& src) noexcept : impl_(src.impl()) {}
 
 signal_base::signal_base(signal_base&& src) : impl_(std::move(src.impl_))
@@ -272,6 +830,18 @@ signal_base::connect(slot_base&& slot_)
   return impl()->connect(std::move(slot_));
 }
 
+signal_base::iterator_type
+signal_base::connect(const slot_base& slot_, int priority)
+{
+  return impl()->connect(slot_, priority);
+}
+
+signal_base::iterator_type
+signal_base::connect(slot_base&& slot_, int priority)
+{
+  return impl()->connect(std::move(slot_), priority);
+}
+
 signal_base::iterator_type
 signal_base::connect_first(const slot_base& slot_)
 {
@@ -322,9 +892,7 @@ std::shared_ptr<internal::signal_impl>
 signal_base::impl() const
 {
   if (!impl_)
-  {
-    impl_ = std::make_shared<internal::signal_impl>();
-  }
+    impl_ = internal::signal_impl::create(nullptr);
   return impl_;
 }
 
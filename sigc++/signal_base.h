@@ -20,8 +20,11 @@
 #define SIGC_SIGNAL_BASE_H
 
 #include <cstddef>
-#include <list>
+#include <iterator>
+#include <map>
 #include <memory> //For std::shared_ptr<>
+#include <memory_resource>
+#include <type_traits>
 #include <sigc++config.h>
 #include <sigc++/type_traits.h>
 #include <sigc++/functors/slot.h>
@@ -35,6 +38,320 @@ namespace sigc
 namespace internal
 {
 
+/// Link of the doubly-linked list in chunked_slot_list.
+struct SIGC_API slot_list_link
+{
+  slot_list_link* prev_;
+  slot_list_link* next_;
+};
+
+struct signal_impl;
+
+/** Node of chunked_slot_list. It's carved out of one of the list's chunks.
+ * The node holds all data that a signal needs per connected slot. It's also
+ * the parent of the slot's slot_rep, which notifies the node when the slot
+ * becomes invalid. See signal_impl::notify_self_and_iter_of_invalidated_slot().
+ */
+struct SIGC_API slot_list_node
+: public slot_list_link
+, public notifiable
+{
+  slot_list_node()
+  : owner_(nullptr), priority_(0), marker_(false), pending_(false), pending_at_begin_(false)
+  {
+  }
+  explicit slot_list_node(const slot_base& slot)
+  : slot_(slot), owner_(nullptr), priority_(0), marker_(false), pending_(false),
+    pending_at_begin_(false)
+  {
+  }
+  explicit slot_list_node(slot_base&& slot)
+  : slot_(std::move(slot)), owner_(nullptr), priority_(0), marker_(false), pending_(false),
+    pending_at_begin_(false)
+  {
+  }
+
+  slot_base slot_;
+
+  /// The signal_impl whose list contains this node.
+  signal_impl* owner_;
+
+  /// The priority that the slot has been connected with.
+  int priority_;
+
+  /// Indicates whether the node is a marker, see chunked_slot_list::link_marker().
+  bool marker_;
+
+  /// Indicates whether the node waits for its position, see insert_into_group().
+  bool pending_;
+
+  /// Indicates whether a pending node is moved to the beginning of its group.
+  bool pending_at_begin_;
+};
+
+/** Bidirectional iterator over the slots in a chunked_slot_list.
+ * @e T_slot is either slot_base or const slot_base.
+ */
+template<typename T_slot>
+struct slot_list_iterator
+{
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::remove_const_t<T_slot>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T_slot*;
+  using reference = T_slot&;
+
+  slot_list_iterator() noexcept : link_(nullptr) {}
+
+  explicit slot_list_iterator(slot_list_link* link) noexcept : link_(link) {}
+
+  /// Converts an iterator to a const_iterator.
+  template<typename T_other,
+    typename = std::enable_if_t<std::is_same<const T_other, T_slot>::value &&
+                                !std::is_same<T_other, T_slot>::value>>
+  slot_list_iterator(const slot_list_iterator<T_other>& src) noexcept : link_(src.link_)
+  {
+  }
+
+  reference operator*() const noexcept { return static_cast<slot_list_node*>(link_)->slot_; }
+  pointer operator->() const noexcept { return &static_cast<slot_list_node*>(link_)->slot_; }
+
+  slot_list_iterator& operator++() noexcept
+  {
+    link_ = link_->next_;
+    return *this;
+  }
+
+  slot_list_iterator operator++(int) noexcept
+  {
+    slot_list_iterator tmp(*this);
+    link_ = link_->next_;
+    return tmp;
+  }
+
+  slot_list_iterator& operator--() noexcept
+  {
+    link_ = link_->prev_;
+    return *this;
+  }
+
+  slot_list_iterator operator--(int) noexcept
+  {
+    slot_list_iterator tmp(*this);
+    link_ = link_->prev_;
+    return tmp;
+  }
+
+  bool operator==(const slot_list_iterator& src) const noexcept { return link_ == src.link_; }
+  bool operator!=(const slot_list_iterator& src) const noexcept { return link_ != src.link_; }
+
+  slot_list_link* link_;
+};
+
+/** The list of slots of a signal_impl.
+ * chunked_slot_list is a doubly-linked list whose nodes are not allocated one by one,
+ * but carved out of chunks of contiguous memory. Slots that are connected one after
+ * the other are therefore adjacent in memory, and walking the list during signal
+ * emission touches as few cache lines as possible.
+ *
+ * Like std::list, the address of a slot never changes, and iterators stay valid
+ * until the slot they point to is erased. Nodes of erased slots are reused by
+ * subsequent insertions. The chunks are released by clear() and the destructor.
+ *
+ * Slots can be inserted with a priority. The slots with the same priority
+ * form a group, and the groups are ordered by descending priority. The list
+ * keeps the first and last slot of each group with a priority other than 0
+ * in a map, so that group_begin() and group_end() find the position of a new
+ * slot in logarithmic time. Lists without such slots don't use the map.
+ *
+ * While markers are linked, e.g. during signal emission, insert_into_group()
+ * appends new slots after the markers, and moves them into their groups when
+ * the last marker is unlinked. A slot that is connected during signal emission
+ * is therefore not invoked until the next one, whatever its priority.
+ */
+class SIGC_API chunked_slot_list
+{
+public:
+  using size_type = std::size_t;
+  using iterator = slot_list_iterator<slot_base>;
+  using const_iterator = slot_list_iterator<const slot_base>;
+
+  chunked_slot_list() noexcept;
+
+  /** Constructs a list whose chunks and slots are allocated from @a resource.
+   * @param resource The memory resource, or @p nullptr to use operator new.
+   */
+  explicit chunked_slot_list(std::pmr::memory_resource* resource) noexcept;
+
+  ~chunked_slot_list();
+
+  chunked_slot_list(const chunked_slot_list& src) = delete;
+  chunked_slot_list& operator=(const chunked_slot_list& src) = delete;
+
+  chunked_slot_list(chunked_slot_list&& src) = delete;
+  chunked_slot_list& operator=(chunked_slot_list&& src) = delete;
+
+  iterator begin() noexcept { return iterator(head_.next_); }
+  iterator end() noexcept { return iterator(&head_); }
+  const_iterator begin() const noexcept
+  {
+    return const_iterator(const_cast<slot_list_link*>(head_.next_));
+  }
+  const_iterator end() const noexcept
+  {
+    return const_iterator(const_cast<slot_list_link*>(&head_));
+  }
+
+  inline bool empty() const noexcept { return size_ == 0; }
+  inline size_type size() const noexcept { return size_; }
+
+  /// Returns the memory resource of the list, or @p nullptr if it uses operator new.
+  inline std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+  /** Inserts a copy of @p slot before @p i.
+   * If the list has a memory resource, the copy is allocated from it.
+   * @param i The position. If @p priority is not 0, it must be
+   *          group_begin(priority) or group_end(priority).
+   * @param slot The slot to copy.
+   * @param priority The priority of the slot.
+   * @return An iterator pointing to the new slot.
+   */
+  iterator insert(iterator i, const slot_base& slot, int priority = 0);
+
+  /** Moves @p slot into the list, before @p i.
+   * If the list has a memory resource, and @p slot has been allocated from
+   * another one, @p slot is copied instead.
+   * @param i The position. If @p priority is not 0, it must be
+   *          group_begin(priority) or group_end(priority).
+   * @param slot The slot to move.
+   * @param priority The priority of the slot.
+   * @return An iterator pointing to the new slot.
+   */
+  iterator insert(iterator i, slot_base&& slot, int priority = 0);
+
+  /// The position of a slot within its group, see insert_into_group().
+  enum class group_position
+  {
+    begin,
+    end
+  };
+
+  /** Inserts a copy of @p slot at the beginning or the end of its group.
+   * If markers are linked, the slot is appended after them instead, and it's
+   * moved into its group when the last marker is unlinked. Its address does not
+   * change, so the returned iterator stays valid.
+   * @param position Where the slot is inserted in its group.
+   * @param slot The slot to copy.
+   * @param priority The priority of the slot.
+   * @return An iterator pointing to the new slot.
+   */
+  iterator insert_into_group(group_position position, const slot_base& slot, int priority);
+
+  /** Moves @p slot to the beginning or the end of its group.
+   * @see insert_into_group(group_position, const slot_base&, int).
+   */
+  iterator insert_into_group(group_position position, slot_base&& slot, int priority);
+
+  /** Returns the position before the first slot with priority @p priority.
+   * If there is no such slot, it's the position where the group would start.
+   */
+  iterator group_begin(int priority) noexcept;
+
+  /** Returns the position after the last slot with priority @p priority.
+   * If there is no such slot, it's the position where the group would start.
+   * Markers that follow the last slot are skipped.
+   */
+  iterator group_end(int priority) noexcept;
+
+  /** Destroys the slot at @p i.
+   * @return An iterator pointing to the slot that followed the erased one.
+   */
+  iterator erase(iterator i);
+
+  /// Destroys all slots and releases the chunks.
+  void clear();
+
+  /** Links @p marker before @p i without taking ownership of it.
+   * A marker is a node that does not belong to the list, e.g. a local variable.
+   * It contains an empty slot and is not included in size().
+   * It must be removed with unlink_marker() before it's destroyed, and it must
+   * not be erased.
+   * @return An iterator pointing to the marker.
+   */
+  iterator link_marker(iterator i, slot_list_node& marker) noexcept;
+
+  /// Removes a marker that was added with link_marker().
+  void unlink_marker(slot_list_node& marker) noexcept;
+
+private:
+  struct chunk;
+
+  /** The first and last slot of a group.
+   * A group whose slots are all pending has no first and last slot, but it's
+   * kept in the map, so that they can be moved into it without allocating.
+   */
+  struct group_bounds
+  {
+    slot_list_node* first_;
+    slot_list_node* last_;
+    size_type pending_;
+  };
+
+  using group_map = std::pmr::map<int, group_bounds>;
+
+  void* allocate_node();
+  void deallocate_node(void* p) noexcept;
+  static iterator link_node(iterator i, slot_list_node* node) noexcept;
+  static void unlink_node(slot_list_node* node) noexcept;
+  void release_chunks() noexcept;
+  bool needs_copy(const slot_base& slot) const noexcept;
+  static bool is_shareable(const slot_base& slot) noexcept;
+  slot_base copy_rep(const slot_base& slot) const;
+
+  template<typename T_slot>
+  iterator insert_node(iterator i, T_slot&& slot, int priority, bool pending);
+  template<typename T_slot>
+  iterator insert_into_group_impl(group_position position, T_slot&& slot, int priority);
+  iterator after(slot_list_node* node) noexcept;
+  group_map::iterator higher_group(int priority) noexcept;
+  group_map::iterator lower_group(int priority) noexcept;
+  group_map::iterator reserve_group(int priority);
+  void unreserve_group(group_map::iterator group) noexcept;
+  void add_to_group(group_map::iterator group, slot_list_node* node) noexcept;
+  void remove_from_group(slot_list_node* node) noexcept;
+  void remove_pending(slot_list_node* node) noexcept;
+  void place_pending() noexcept;
+
+  /// Sentinel of the circular list. head_.next_ is the first slot, head_.prev_ the last one.
+  slot_list_link head_;
+  size_type size_;
+
+  /// Unused nodes, singly-linked through slot_list_link::next_.
+  slot_list_link* free_;
+
+  /// Allocated chunks, most recent first.
+  chunk* chunks_;
+
+  /// The memory resource of the chunks and slots, if any.
+  std::pmr::memory_resource* resource_;
+
+  /// The bounds of the groups of slots with a priority other than 0, by priority.
+  group_map groups_;
+
+  /// The number of linked markers.
+  size_type markers_;
+
+  /// The number of slots that wait for their position, see insert_into_group().
+  size_type pending_;
+
+  /** Storage for one node.
+   * Most signals have no more than one slot. The first node is taken from here,
+   * so such a signal needs no chunk. Further nodes are taken from chunks.
+   */
+  alignas(slot_list_node) unsigned char inline_node_[sizeof(slot_list_node)];
+  bool inline_node_used_;
+};
+
 /** Implementation of the signal interface.
  * signal_impl manages a list of slots. When a slot becomes invalid (because some
  * referred object dies), notify_self_and_iter_of_invalidated_slot() is executed.
@@ -42,14 +359,21 @@ namespace internal
  * or defers the execution of erase() to sweep() when the signal is being emitted.
  * sweep() removes all invalid slots from the list.
  */
-struct SIGC_API signal_impl : public std::enable_shared_from_this<signal_impl>
+struct SIGC_API signal_impl
 {
   using size_type = std::size_t;
-  using slot_list = std::list<slot_base>;
+  using slot_list = chunked_slot_list;
   using iterator_type = slot_list::iterator;
   using const_iterator_type = slot_list::const_iterator;
 
   signal_impl();
+
+  /** Constructs a signal_impl whose slots are allocated from @a resource.
+   * Use create() to allocate the signal_impl itself from @a resource.
+   * @param resource The memory resource, or @p nullptr to use operator new.
+   */
+  explicit signal_impl(std::pmr::memory_resource* resource) noexcept;
+
   ~signal_impl();
 
   signal_impl(const signal_impl& src) = delete;
@@ -70,13 +394,35 @@ struct SIGC_API signal_impl : public std::enable_shared_from_this<signal_impl>
   /** Decrements the reference and execution counter.
    * Invokes sweep() if the execution counter reaches zero and the
    * removal of one or more slots has been deferred.
+   * Deletes this if the execution counter reaches zero and destroy()
+   * has been called in the meantime.
    */
   inline void unreference_exec()
   {
-    if (!(--exec_count_) && deferred_)
-      sweep();
+    if (!(--exec_count_) && (deferred_ || destroy_pending_))
+      release_exec();
   }
 
+  /** Deletes a signal_impl object.
+   * This is the deleter of the std::shared_ptr that owns the object.
+   * If the signal is being emitted, the deletion is deferred until the
+   * execution counter reaches zero. The execution counter is not atomic,
+   * so emitting the signal is cheaper than copying a std::shared_ptr.
+   * @param impl The object to delete.
+   */
+  static void destroy(signal_impl* impl);
+
+  /** Creates a signal_impl that is owned by a std::shared_ptr.
+   * If @a resource is not @p nullptr, the signal_impl, the shared_ptr's control
+   * block, and the connected slots are allocated from it.
+   * @param resource The memory resource, or @p nullptr to use operator new.
+   * @return The new signal_impl.
+   */
+  static std::shared_ptr<signal_impl> create(std::pmr::memory_resource* resource);
+
+  /// Returns the memory resource of the signal_impl, or @p nullptr if it uses operator new.
+  inline std::pmr::memory_resource* resource() const noexcept { return slots_.resource(); }
+
   /** Returns whether the list of slots is empty.
    * @return @p true if the list of slots is empty.
    */
@@ -123,6 +469,20 @@ struct SIGC_API signal_impl : public std::enable_shared_from_this<signal_impl>
    */
   iterator_type connect(slot_base&& slot_);
 
+  /** Adds a slot after the slots with the same or a higher priority.
+   * @param slot_ The slot to add to the list of slots.
+   * @param priority The priority of the slot.
+   * @return An iterator pointing to the new slot in the list.
+   */
+  iterator_type connect(const slot_base& slot_, int priority);
+
+  /** Adds a slot after the slots with the same or a higher priority.
+   * @param slot_ The slot to add to the list of slots.
+   * @param priority The priority of the slot.
+   * @return An iterator pointing to the new slot in the list.
+   */
+  iterator_type connect(slot_base&& slot_, int priority);
+
   /** Adds a slot at the beginning of the list of slots.
    * @param slot_ The slot to add to the list of slots.
    * @return An iterator pointing to the new slot in the list.
@@ -158,22 +518,51 @@ struct SIGC_API signal_impl : public std::enable_shared_from_this<signal_impl>
   /// Removes invalid slots from the list of slots.
   void sweep();
 
+  /** Returns the signal_impl whose list of slots contains @a slot.
+   * @param slot A slot.
+   * @return The signal_impl, or @p nullptr if @a slot is not connected to a signal.
+   */
+  static signal_impl* owner(const slot_base& slot) noexcept;
+
+  /** Returns the only slot in the list, if there is exactly one and the signal
+   * is not being emitted.
+   * Then no marker of an ongoing emission is linked into the list, and the
+   * slot can be invoked without walking the list.
+   * @return A pointer to the slot, or @p nullptr.
+   */
+  inline const slot_base* single_slot() const noexcept
+  {
+    if (slots_.size() != 1 || exec_count_)
+      return nullptr;
+    return &*slots_.begin();
+  }
+
 private:
+  /// Sweeps or deletes this, when the execution counter has reached zero.
+  void release_exec();
+
+  /// Deletes @p impl, returning its memory to its memory resource, if any.
+  static void dispose(signal_impl* impl) noexcept;
+
   /** Callback that is executed when some slot becomes invalid.
    * This callback is registered in every slot when inserted into
    * the list of slots. It is executed when a slot becomes invalid
    * because of some referred object being destroyed.
    * It either calls slots_.erase() directly or defers the execution of
    * erase() to sweep() when the signal is being emitted.
-   * @param d A local structure, created in insert().
+   * @param d The slot_list_node of the invalidated slot.
    */
   static void notify_self_and_iter_of_invalidated_slot(notifiable* d);
 
-  void add_notification_to_iter(const signal_impl::iterator_type& iter);
+  /** Makes the node pointed to by @p iter the parent of its slot.
+   * No memory is allocated. The node itself holds the data that
+   * notify_self_and_iter_of_invalidated_slot() needs.
+   */
+  void add_notification_to_iter(const signal_impl::iterator_type& iter) noexcept;
 
 public:
   /// The list of slots.
-  std::list<slot_base> slots_;
+  slot_list slots_;
 
 private:
   /** Execution counter.
@@ -183,6 +572,9 @@ private:
 
   /// Indicates whether the execution of sweep() is being deferred.
   bool deferred_;
+
+  /// Indicates whether destroy() has been called during signal emission.
+  bool destroy_pending_;
 };
 
 struct SIGC_API signal_impl_exec_holder
@@ -327,6 +719,13 @@ struct SIGC_API signal_base
 
   signal_base() noexcept;
 
+  /** Constructs a signal whose internal data is allocated from @a resource.
+   * This includes the list of slots and the slots that are connected to it.
+   * @param resource The memory resource. It must outlive the signal,
+   *                 its copies, and its connected slots.
+   */
+  explicit signal_base(std::pmr::memory_resource* resource);
+
   signal_base(const signal_base& src) noexcept;
 
   signal_base(signal_base&& src);
@@ -397,6 +796,20 @@ protected:
    */
   iterator_type connect(slot_base&& slot_);
 
+  /** Adds a slot after the slots with the same or a higher priority.
+   * With %connect(), slots can also be added during signal emission.
+   * In this case, they won't be executed until the next emission occurs.
+   * @param slot_ The slot to add to the list of slots.
+   * @param priority The priority of the slot.
+   * @return An iterator pointing to the new slot in the list.
+   */
+  iterator_type connect(const slot_base& slot_, int priority);
+
+  /** Adds a slot after the slots with the same or a higher priority.
+   * @see connect(const slot_base& slot_, int priority).
+   */
+  iterator_type connect(slot_base&& slot_, int priority);
+
   /** Adds a slot at the beginning of the list of slots.
    * With %connect_first(), slots can also be added during signal emission.
    * In this case, they won't be executed until the next emission occurs.
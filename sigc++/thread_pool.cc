@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#include <sigc++/thread_pool.h>
+#include <atomic>
+#include <exception>
+
+namespace sigc
+{
+
+// The state of one call of parallel_for().
+struct thread_pool::job
+{
+  job(size_type size, const std::function<void(size_type)>& task)
+  : size_(size), task_(task), next_(0), users_(0)
+  {
+  }
+
+  const size_type size_;
+  const std::function<void(size_type)>& task_;
+
+  /// The index of the next task to start. Tasks are claimed with fetch_add().
+  std::atomic<size_type> next_;
+
+  /// The number of worker threads that run tasks of this job. Guarded by mutex_.
+  size_type users_;
+
+  std::mutex exception_mutex_;
+  std::exception_ptr exception_;
+};
+
+thread_pool::thread_pool(unsigned int n_threads) : stopping_(false)
+{
+  threads_.reserve(n_threads);
+  try
+  {
+    for (unsigned int i = 0; i < n_threads; ++i)
+      threads_.emplace_back(&thread_pool::run_worker, this);
+  }
+  catch (...)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    work_available_.notify_all();
+    for (auto& thread : threads_)
+      thread.join();
+    throw;
+  }
+}
+
+thread_pool::~thread_pool()
+{
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_available_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+// static
+unsigned int
+thread_pool::default_thread_count() noexcept
+{
+  const auto n = std::thread::hardware_concurrency();
+  return n > 1 ? n - 1 : 1;
+}
+
+// static
+void
+thread_pool::run_job(job& j) noexcept
+{
+  for (;;)
+  {
+    const auto i = j.next_.fetch_add(1);
+    if (i >= j.size_)
+      return;
+
+    try
+    {
+      j.task_(i);
+    }
+    catch (...)
+    {
+      const std::lock_guard<std::mutex> lock(j.exception_mutex_);
+      if (!j.exception_)
+        j.exception_ = std::current_exception();
+    }
+  }
+}
+
+void
+thread_pool::run_worker()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;)
+  {
+    work_available_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+    if (stopping_)
+      return;
+
+    auto j = jobs_.front();
+    if (j->next_.load() >= j->size_)
+    {
+      // All tasks of the job have been started.
+      jobs_.pop_front();
+      continue;
+    }
+
+    ++j->users_;
+    lock.unlock();
+    run_job(*j);
+    lock.lock();
+
+    // The job can't be destroyed before users_ has reached 0.
+    if (--j->users_ == 0)
+      job_released_.notify_all();
+  }
+}
+
+void
+thread_pool::parallel_for(size_type n, const std::function<void(size_type)>& task)
+{
+  if (n == 0)
+    return;
+
+  job j(n, task);
+  if (n > 1 && !threads_.empty())
+  {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(&j);
+    }
+    work_available_.notify_all();
+  }
+
+  run_job(j);
+
+  {
+    // Wait until no worker thread uses the job any more.
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto iter = std::find(jobs_.begin(), jobs_.end(), &j);
+    if (iter != jobs_.end())
+      jobs_.erase(iter);
+    job_released_.wait(lock, [&j]() { return j.users_ == 0; });
+  }
+
+  if (j.exception_)
+    std::rethrow_exception(j.exception_);
+}
+
+} /* namespace sigc */
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_THREAD_POOL_H
+#define SIGC_THREAD_POOL_H
+
+#include <sigc++config.h>
+#include <sigc++/signal.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace sigc
+{
+
+/** Pool of worker threads for sigc::signal_with_accumulator::emit_parallel().
+ * A thread that calls parallel_for() takes part in the work, so a pool
+ * can be shared by several emitting threads, and a slot that is run by
+ * the pool may emit another signal on the same pool.
+ *
+ * The pool is not work-stealing. The calls of parallel_for() are queued in
+ * a single queue that all worker threads share, and the threads claim the
+ * tasks of a call one at a time from a shared counter.
+ *
+ * @ingroup signal
+ */
+class SIGC_API thread_pool
+{
+public:
+  using size_type = std::size_t;
+
+  /** Starts the worker threads.
+   * @param n_threads The number of worker threads. The thread that calls
+   *                  parallel_for() works in addition to them.
+   */
+  explicit thread_pool(unsigned int n_threads = default_thread_count());
+
+  thread_pool(const thread_pool& src) = delete;
+  thread_pool& operator=(const thread_pool& src) = delete;
+  thread_pool(thread_pool&& src) = delete;
+  thread_pool& operator=(thread_pool&& src) = delete;
+
+  /// Waits for the running tasks and joins the worker threads.
+  ~thread_pool();
+
+  /// Returns the number of worker threads.
+  inline size_type size() const noexcept { return threads_.size(); }
+
+  /** Runs @a task(i) for each i in [0, @a n) and waits until all have finished.
+   * The tasks are distributed dynamically among the worker threads and the
+   * calling thread. If tasks throw exceptions, one of them is rethrown
+   * after all tasks have finished.
+   * @param n The number of tasks.
+   * @param task The function that runs a task.
+   */
+  void parallel_for(size_type n, const std::function<void(size_type)>& task);
+
+  /// Returns one less than the number of hardware threads, but at least 1.
+  static unsigned int default_thread_count() noexcept;
+
+private:
+  struct job;
+
+  void run_worker();
+  static void run_job(job& j) noexcept;
+
+  std::vector<std::thread> threads_;
+
+  /// Jobs with tasks that have not been started yet. Guarded by mutex_.
+  std::deque<job*> jobs_;
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable job_released_;
+  bool stopping_;
+};
+
+namespace internal
+{
+
+/** Implements signal_with_accumulator::emit_parallel().
+ * The slots are collected in the emitting thread and split into contiguous
+ * ranges. Each range is one task of thread_pool::parallel_for(). A task
+ * combines the results of its slots with its own copy of the combiner, and
+ * the emitting thread combines the results of the tasks in order. Thus the
+ * combiner must be associative, but need not be commutative, and it's never
+ * called concurrently.
+ */
+template<typename T_return, typename... T_arg>
+struct signal_emit_parallel
+{
+  static_assert(!(std::is_rvalue_reference_v<T_arg> || ...),
+    "Rvalue reference arguments can't be passed to several slots in parallel.");
+
+  using slot_type = slot<T_return(T_arg...)>;
+  using call_type = typename slot_type::call_type;
+  using size_type = std::size_t;
+
+  /// Returns the slots that shall be invoked.
+  static std::vector<slot_rep*> collect(signal_impl* impl)
+  {
+    std::vector<slot_rep*> reps;
+    reps.reserve(impl->slots_.size());
+    for (const auto& slot : const_cast<const signal_impl::slot_list&>(impl->slots_))
+    {
+      if (!slot.empty() && !slot.blocked())
+        reps.push_back(slot.rep_);
+    }
+    return reps;
+  }
+
+  /// Returns the number of tasks for @a n slots.
+  static size_type task_count(const thread_pool& pool, size_type n) noexcept
+  {
+    // A few tasks per thread balance the load when slots take different times.
+    return std::min(n, 4 * (pool.size() + 1));
+  }
+
+  template<typename T_value, typename T_combiner>
+  static T_value emit(thread_pool& pool, const std::shared_ptr<signal_impl>& impl, T_value init,
+    T_combiner& combine, type_trait_take_t<T_arg>... a)
+  {
+    if (!impl || impl->slots_.empty())
+      return init;
+
+    signal_impl_exec_holder exec(impl.get());
+    const auto reps = collect(impl.get());
+    const auto n_tasks = task_count(pool, reps.size());
+    std::vector<std::optional<T_value>> partials(n_tasks);
+
+    pool.parallel_for(n_tasks,
+      [&](size_type t)
+      {
+        T_combiner task_combine(combine);
+        std::optional<T_value> partial;
+        const auto end = (t + 1) * reps.size() / n_tasks;
+        for (auto i = t * reps.size() / n_tasks; i < end; ++i)
+        {
+          auto r = (sigc::internal::function_pointer_cast<call_type>(reps[i]->call_))(reps[i], a...);
+          if (partial)
+            partial = task_combine(std::move(*partial), std::move(r));
+          else
+            partial.emplace(std::move(r));
+        }
+        partials[t] = std::move(partial);
+      });
+
+    for (auto& partial : partials)
+    {
+      if (partial)
+        init = combine(std::move(init), std::move(*partial));
+    }
+    return init;
+  }
+
+  static void emit(thread_pool& pool, const std::shared_ptr<signal_impl>& impl,
+    type_trait_take_t<T_arg>... a)
+  {
+    if (!impl || impl->slots_.empty())
+      return;
+
+    signal_impl_exec_holder exec(impl.get());
+    const auto reps = collect(impl.get());
+    const auto n_tasks = task_count(pool, reps.size());
+
+    pool.parallel_for(n_tasks,
+      [&](size_type t)
+      {
+        const auto end = (t + 1) * reps.size() / n_tasks;
+        for (auto i = t * reps.size() / n_tasks; i < end; ++i)
+          (sigc::internal::function_pointer_cast<call_type>(reps[i]->call_))(reps[i], a...);
+      });
+  }
+};
+
+} /* namespace internal */
+
+} /* namespace sigc */
+
+#endif /* SIGC_THREAD_POOL_H */
@@ -0,0 +1,354 @@
+/*
+ * Copyright 2026, The libsigc++ Development Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef SIGC_TOPIC_BUS_H
+#define SIGC_TOPIC_BUS_H
+
+#include <sigc++/signal.h>
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sigc
+{
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<typename T_signature>
+class topic_bus;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** Publish/subscribe bus with hierarchical topics.
+ *
+ * Topics are strings of segments, separated by dots, such as
+ * <tt>"market.nasdaq.trades"</tt>. subscribe() connects a slot to a pattern
+ * of segments, where <tt>"*"</tt> matches exactly one segment and
+ * <tt>"#"</tt> matches zero or more segments. For instance
+ * <tt>"market.*.trades"</tt> and <tt>"market.#"</tt> both match
+ * <tt>"market.nasdaq.trades"</tt>.
+ *
+ * The patterns are stored in a trie of segments, each node of which has a
+ * sigc::signal for the slots that are subscribed to its pattern. publish()
+ * walks the trie only along the segments of the topic, and caches the
+ * signals that it found, so that the next publication on the same topic
+ * needs a single hash lookup. The cache is discarded when a new pattern is
+ * subscribed to.
+ *
+ * Slots are disconnected with the returned connection, or automatically when
+ * an object that they are bound to is destroyed, like slots of a sigc::signal.
+ * The return values of the slots are discarded.
+ *
+ * @par Example:
+ * @code
+ * sigc::topic_bus<void(const std::string& topic, const Trade&)> bus;
+ * bus.subscribe("market.*.trades", sigc::mem_fun(recorder, &Recorder::on_trade));
+ * bus.publish("market.nasdaq.trades", trade); // Invokes Recorder::on_trade().
+ * @endcode
+ * The topic is passed on to the slots only if it's one of the arguments.
+ *
+ * The arguments are passed on to several slots, so they can't be rvalue
+ * references. Use a value or a const reference instead.
+ *
+ * @ingroup signal
+ */
+template<typename T_return, typename... T_arg>
+class topic_bus<T_return(T_arg...)>
+{
+  static_assert(!(std::is_rvalue_reference_v<T_arg> || ...),
+    "Rvalue reference arguments can't be passed to several slots by a topic_bus.");
+
+public:
+  using signal_type = signal<T_return(T_arg...)>;
+  using slot_type = slot<T_return(T_arg...)>;
+  using size_type = std::size_t;
+
+  /// The maximum number of topics whose matches are cached.
+  static constexpr size_type max_cached_topics = 4096;
+
+  topic_bus() = default;
+
+  topic_bus(const topic_bus& src) = delete;
+  topic_bus& operator=(const topic_bus& src) = delete;
+
+  /** Subscribes a slot to a pattern of topics.
+   * The slots that are subscribed to one pattern are invoked in the order in
+   * which they were subscribed. If a topic matches several patterns, all of
+   * their slots are invoked, pattern by pattern. Segments that are spelled
+   * out are tried before <tt>"*"</tt>, and <tt>"*"</tt> before <tt>"#"</tt>.
+   * @param pattern Dot-separated segments, where <tt>"*"</tt> matches one
+   *        segment of a topic and <tt>"#"</tt> any number of segments.
+   * @param slot_ The slot to invoke when a matching topic is published.
+   * @return A connection.
+   */
+  connection subscribe(std::string_view pattern, const slot_type& slot_)
+  {
+    return find_or_add(pattern).signal_.connect(slot_);
+  }
+
+  /** Subscribes a slot to a pattern of topics.
+   * @see subscribe(std::string_view pattern, const slot_type& slot_).
+   */
+  connection subscribe(std::string_view pattern, slot_type&& slot_)
+  {
+    return find_or_add(pattern).signal_.connect(std::move(slot_));
+  }
+
+  /** Invokes the slots that are subscribed to patterns matching @a topic.
+   * @param topic Dot-separated segments, without wildcards.
+   * @param a Arguments to be passed on to the slots.
+   */
+  void publish(const std::string& topic, type_trait_take_t<T_arg>... a) const
+  {
+    emission_guard guard(*this);
+
+    if (!cache_stale_)
+    {
+      const auto iter = cache_.find(topic);
+      if (iter != cache_.end())
+      {
+        emit_all(iter->second, a...);
+        return;
+      }
+    }
+
+    auto matches = match(topic);
+    if (cache_stale_ || cache_.size() >= max_cached_topics)
+    {
+      emit_all(matches, a...);
+      return;
+    }
+    // Inserting doesn't invalidate the entries that are being emitted.
+    emit_all(cache_.emplace(topic, std::move(matches)).first->second, a...);
+  }
+
+  /** Returns the number of slots that would be invoked by publish().
+   * @param topic Dot-separated segments, without wildcards.
+   */
+  size_type count(const std::string& topic) const
+  {
+    size_type result = 0;
+    for (const auto n : match(topic))
+      result += n->signal_.size();
+    return result;
+  }
+
+  /// Returns whether no slots are subscribed.
+  bool empty() const noexcept { return root_.empty(); }
+
+  /** Unsubscribes all slots, and forgets all patterns.
+   * If this is called during publication, the patterns are forgotten
+   * when the publication is finished.
+   */
+  void clear()
+  {
+    root_.clear();
+    prune();
+  }
+
+  /** Forgets the patterns that no slots are subscribed to any more.
+   * Disconnecting a slot doesn't remove its pattern from the trie,
+   * so that subscribing to it again is cheap. If this is called during
+   * publication, the patterns are forgotten when the publication is finished.
+   */
+  void prune()
+  {
+    if (emitting_)
+    {
+      prune_pending_ = true;
+      return;
+    }
+    prune(root_);
+    cache_.clear();
+    cache_stale_ = false;
+    prune_pending_ = false;
+  }
+
+private:
+  // A node of the trie. Wildcard segments are children like the others.
+  struct node
+  {
+    bool empty() const noexcept
+    {
+      if (!signal_.empty())
+        return false;
+      for (const auto& child : children_)
+      {
+        if (!child.second->empty())
+          return false;
+      }
+      return true;
+    }
+
+    void clear()
+    {
+      signal_.clear();
+      for (auto& child : children_)
+        child.second->clear();
+    }
+
+    signal_type signal_;
+    std::map<std::string, std::unique_ptr<node>, std::less<>> children_;
+  };
+
+  using match_list = std::vector<const node*>;
+
+  // Counts the nested publications. Like a signal's execution counter,
+  // it defers the changes that would invalidate the cache during emission.
+  struct emission_guard
+  {
+    explicit emission_guard(const topic_bus& bus) noexcept : bus_(bus) { ++bus_.emitting_; }
+
+    emission_guard(const emission_guard& src) = delete;
+    emission_guard& operator=(const emission_guard& src) = delete;
+
+    ~emission_guard()
+    {
+      if (--bus_.emitting_ != 0)
+        return;
+      if (bus_.prune_pending_)
+      {
+        // Only the non-const members clear() and prune() request this.
+        const_cast<topic_bus&>(bus_).prune();
+      }
+      else if (bus_.cache_stale_)
+      {
+        bus_.cache_.clear();
+        bus_.cache_stale_ = false;
+      }
+    }
+
+    const topic_bus& bus_;
+  };
+
+  template<typename T_func>
+  static void for_each_segment(std::string_view str, T_func func)
+  {
+    for (;;)
+    {
+      const auto dot = str.find('.');
+      func(str.substr(0, dot));
+      if (dot == std::string_view::npos)
+        break;
+      str.remove_prefix(dot + 1);
+    }
+  }
+
+  static void emit_all(const match_list& matches, type_trait_take_t<T_arg>... a)
+  {
+    for (const auto n : matches)
+      n->signal_.emit(a...);
+  }
+
+  node& find_or_add(std::string_view pattern)
+  {
+    node* n = &root_;
+    bool added = false;
+    for_each_segment(pattern, [&n, &added](std::string_view segment) {
+      auto iter = n->children_.find(segment);
+      if (iter == n->children_.end())
+      {
+        iter = n->children_.emplace(std::string(segment), std::make_unique<node>()).first;
+        added = true;
+      }
+      n = iter->second.get();
+    });
+
+    if (added)
+    {
+      // Cached matches may lack the new pattern.
+      if (emitting_)
+        cache_stale_ = true;
+      else
+        cache_.clear();
+    }
+    return *n;
+  }
+
+  static void add_matches(const node& n,
+    const std::vector<std::string_view>& segments,
+    std::size_t i,
+    match_list& matches)
+  {
+    const auto& children = n.children_;
+    if (i == segments.size())
+    {
+      // A node can be reached along several paths, such as "#.#".
+      if (std::find(matches.begin(), matches.end(), &n) == matches.end())
+        matches.push_back(&n);
+    }
+    else
+    {
+      const auto exact = children.find(segments[i]);
+      if (exact != children.end())
+        add_matches(*exact->second, segments, i + 1, matches);
+
+      const auto any_one = children.find(std::string_view("*"));
+      if (any_one != children.end())
+        add_matches(*any_one->second, segments, i + 1, matches);
+    }
+
+    const auto any_rest = children.find(std::string_view("#"));
+    if (any_rest != children.end())
+    {
+      // "#" matches any number of the remaining segments, including none.
+      for (auto j = i; j <= segments.size(); ++j)
+        add_matches(*any_rest->second, segments, j, matches);
+    }
+  }
+
+  match_list match(std::string_view topic) const
+  {
+    std::vector<std::string_view> segments;
+    for_each_segment(topic, [&segments](std::string_view segment) { segments.push_back(segment); });
+
+    match_list matches;
+    add_matches(root_, segments, 0, matches);
+    return matches;
+  }
+
+  // Removes the children of a node that have no slots in their subtrees.
+  static void prune(node& n)
+  {
+    auto& children = n.children_;
+    for (auto iter = children.begin(); iter != children.end();)
+    {
+      prune(*iter->second);
+      if (iter->second->signal_.empty() && iter->second->children_.empty())
+        iter = children.erase(iter);
+      else
+        ++iter;
+    }
+  }
+
+  node root_;
+  mutable std::unordered_map<std::string, match_list> cache_;
+  mutable int emitting_ = 0;
+  mutable bool cache_stale_ = false;
+  bool prune_pending_ = false;
+};
+
+} /* namespace sigc */
+
+#endif /* SIGC_TOPIC_BUS_H */
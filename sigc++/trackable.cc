@@ -18,6 +18,8 @@
  */
 
 #include <sigc++/trackable.h>
+#include <memory>
+#include <new>
 
 namespace sigc
 {
@@ -59,15 +61,26 @@ trackable::operator=(trackable&& src) noexcept
   return *this;
 }
 
+trackable::trackable(internal::trackable_callback_list* list) noexcept : callback_list_(list) {}
+
+trackable::trackable(std::pmr::memory_resource* resource)
+: callback_list_(internal::trackable_callback_list::create(resource))
+{
+}
+
 trackable::~trackable()
 {
   notify_callbacks();
+
+  // notify_callbacks() keeps a list with a memory resource.
+  if (callback_list_ && !callback_list_->has_inline_buffer())
+    internal::trackable_callback_list::destroy(callback_list_);
 }
 
-void
+trackable::callback_handle
 trackable::add_destroy_notify_callback(notifiable* data, func_destroy_notify func) const
 {
-  callback_list()->add_callback(data, func);
+  return callback_list()->add_callback(data, func);
 }
 
 void
@@ -76,9 +89,23 @@ trackable::remove_destroy_notify_callback(notifiable* data) const
   callback_list()->remove_callback(data);
 }
 
+void
+trackable::remove_destroy_notify_callback(notifiable* data, callback_handle handle) const
+{
+  callback_list()->remove_callback(data, handle);
+}
+
 void
 trackable::notify_callbacks()
 {
+  if (callback_list_ && (callback_list_->has_inline_buffer() || callback_list_->resource()))
+  {
+    // The list is owned by an inline_trackable, or it shall keep allocating
+    // from its memory resource when callbacks are added again.
+    callback_list_->clear(); // This invokes all of the callbacks.
+    return;
+  }
+
   delete callback_list_; // This invokes all of the callbacks.
   callback_list_ = nullptr;
 }
@@ -95,62 +122,215 @@ trackable::callback_list() const
 namespace internal
 {
 
+trackable_callback_list::trackable_callback_list() noexcept
+: callbacks_(nullptr),
+  size_(0),
+  capacity_(0),
+  buffer_(nullptr),
+  resource_(nullptr),
+  free_(invalid_handle),
+  current_(0),
+  clearing_(false)
+{
+}
+
+trackable_callback_list::trackable_callback_list(void* buffer, size_type capacity) noexcept
+: callbacks_(static_cast<trackable_callback*>(buffer)),
+  size_(0),
+  capacity_(capacity),
+  buffer_(static_cast<trackable_callback*>(buffer)),
+  resource_(nullptr),
+  free_(invalid_handle),
+  current_(0),
+  clearing_(false)
+{
+}
+
+trackable_callback_list::trackable_callback_list(std::pmr::memory_resource* resource) noexcept
+: callbacks_(nullptr),
+  size_(0),
+  capacity_(0),
+  buffer_(nullptr),
+  resource_(resource),
+  free_(invalid_handle),
+  current_(0),
+  clearing_(false)
+{
+}
+
+// static
+trackable_callback_list*
+trackable_callback_list::create(std::pmr::memory_resource* resource)
+{
+  if (!resource)
+    return new trackable_callback_list;
+
+  auto p = resource->allocate(sizeof(trackable_callback_list), alignof(trackable_callback_list));
+  return new (p) trackable_callback_list(resource);
+}
+
+// static
+void
+trackable_callback_list::destroy(trackable_callback_list* list)
+{
+  const auto resource = list->resource_;
+  if (!resource)
+  {
+    delete list;
+    return;
+  }
+
+  list->~trackable_callback_list();
+  resource->deallocate(list, sizeof(trackable_callback_list), alignof(trackable_callback_list));
+}
+
 trackable_callback_list::~trackable_callback_list()
+{
+  invoke_callbacks();
+  deallocate_array();
+}
+
+void
+trackable_callback_list::invoke_callbacks()
 {
   clearing_ = true;
 
-  for (auto& callback : callbacks_)
+  // Callbacks are not added or erased while the list is being cleared,
+  // but a callback can remove another callback by clearing its func_.
+  for (current_ = 0; current_ < size_; ++current_)
   {
+    auto& callback = callbacks_[current_];
     if (callback.func_)
       callback.func_(callback.data_);
   }
 }
 
-void
+trackable_callback_list::handle_type
 trackable_callback_list::add_callback(notifiable* data, func_destroy_notify func)
 {
   // TODO: Is it okay to silently ignore attempts to add dependencies when the list
   // is being cleared?
   // I'd consider this a serious application bug, since the app is likely to segfault.
   // But then, how should we handle it? Throw an exception? Martin.
-  if (!clearing_)
-    callbacks_.emplace_back(trackable_callback(data, func));
+  if (clearing_)
+    return invalid_handle;
+
+  // trackable_callback is trivially destructible.
+  if (free_ != invalid_handle)
+  {
+    const auto i = free_;
+    free_ = callbacks_[i].next_free_;
+    new (callbacks_ + i) trackable_callback(data, func);
+    return i;
+  }
+
+  if (size_ == capacity_)
+    grow();
+
+  new (callbacks_ + size_) trackable_callback(data, func);
+  return size_++;
 }
 
 void
-trackable_callback_list::clear()
+trackable_callback_list::grow()
 {
-  clearing_ = true;
+  const size_type capacity = capacity_ ? 2 * capacity_ : 4;
+  const auto bytes = capacity * sizeof(trackable_callback);
+  auto callbacks = static_cast<trackable_callback*>(resource_
+      ? resource_->allocate(bytes, alignof(trackable_callback))
+      : ::operator new(bytes));
+  std::uninitialized_copy(callbacks_, callbacks_ + size_, callbacks);
 
-  for (auto& callback : callbacks_)
-  {
-    if (callback.func_)
-      callback.func_(callback.data_);
-  }
+  deallocate_array();
 
-  callbacks_.clear();
+  callbacks_ = callbacks;
+  capacity_ = capacity;
+}
+
+void
+trackable_callback_list::deallocate_array() noexcept
+{
+  if (callbacks_ == buffer_)
+    return;
+
+  if (resource_)
+    resource_->deallocate(
+      callbacks_, capacity_ * sizeof(trackable_callback), alignof(trackable_callback));
+  else
+    ::operator delete(callbacks_);
+}
+
+void
+trackable_callback_list::clear()
+{
+  invoke_callbacks();
+
+  // Keep the memory, if it's been allocated.
+  size_ = 0;
+  free_ = invalid_handle;
 
   clearing_ = false;
 }
 
+void
+trackable_callback_list::remove_at(size_type i) noexcept
+{
+  auto& callback = callbacks_[i];
+
+  // Don't remove an array element while the list is being cleared.
+  // It would invalidate the index in ~trackable_callback_list() or clear().
+  // But it may be necessary to invalidate the callback. See bug 589202.
+  callback.func_ = nullptr;
+  if (clearing_)
+    return;
+
+  // Keep the other callbacks in place, so that their handles stay valid.
+  callback.next_free_ = free_;
+  free_ = i;
+}
+
 void
 trackable_callback_list::remove_callback(notifiable* data)
 {
-  for (auto i = callbacks_.begin(); i != callbacks_.end(); ++i)
+  // When a trackable is destroyed, its callbacks usually lead to the removal
+  // of the callback that is being invoked. Check that one first, to avoid
+  // quadratic complexity when a trackable with many callbacks is destroyed.
+  if (clearing_ && current_ < size_)
+  {
+    const auto& callback = callbacks_[current_];
+    if (callback.func_ != nullptr && callback.data_ == data)
+    {
+      remove_at(current_);
+      return;
+    }
+  }
+
+  for (size_type i = 0; i < size_; ++i)
+  {
+    const auto& callback = callbacks_[i];
+    if (callback.func_ != nullptr && callback.data_ == data)
+    {
+      remove_at(i);
+      return;
+    }
+  }
+}
+
+void
+trackable_callback_list::remove_callback(notifiable* data, handle_type handle)
+{
+  if (handle < size_)
   {
-    auto& callback = *i;
-    if (callback.data_ == data && callback.func_ != nullptr)
+    const auto& callback = callbacks_[handle];
+    if (callback.func_ != nullptr && callback.data_ == data)
     {
-      // Don't remove a list element while the list is being cleared.
-      // It could invalidate the iterator in ~trackable_callback_list() or clear().
-      // But it may be necessary to invalidate the callback. See bug 589202.
-      if (clearing_)
-        callback.func_ = nullptr;
-      else
-        callbacks_.erase(i);
+      remove_at(handle);
       return;
     }
   }
+
+  // The handle is invalid, e.g. because the list has been cleared.
+  remove_callback(data);
 }
 
 } /* namespace internal */
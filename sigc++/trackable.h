@@ -18,7 +18,9 @@
  */
 #ifndef SIGC_TRACKABLE_HPP
 #define SIGC_TRACKABLE_HPP
-#include <list>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
 #include <sigc++config.h>
 
 namespace sigc
@@ -39,7 +41,12 @@ using func_destroy_notify = void (*)(notifiable* data);
  */
 struct SIGC_API trackable_callback
 {
-  notifiable* data_;
+  union
+  {
+    notifiable* data_;
+    /// The next removed callback, if func_ is @p nullptr. See trackable_callback_list.
+    std::size_t next_free_;
+  };
   func_destroy_notify func_;
   trackable_callback(notifiable* data, func_destroy_notify func) noexcept : data_(data), func_(func)
   {
@@ -47,30 +54,82 @@ struct SIGC_API trackable_callback
 };
 
 /** Callback list.
- * A callback list holds an STL list of callbacks of type
+ * A callback list holds a contiguous array of callbacks of type
  * trackable_callback. Callbacks are added and removed with
  * add_callback(), remove_callback() and clear(). The callbacks
  * are invoked from clear() and from the destructor.
+ *
+ * The array can start out in a buffer that is owned by someone else,
+ * see sigc::inline_trackable. It is moved to the heap when it outgrows
+ * that buffer.
+ *
+ * add_callback() returns a handle that identifies the callback. If it's
+ * passed to remove_callback(), the callback is removed in constant time.
+ * Removed callbacks are not compacted away, but kept in a free list and
+ * reused by add_callback(), so a handle stays valid until its callback is
+ * removed. Therefore the callbacks are not necessarily invoked in the order
+ * in which they were added.
  */
 struct SIGC_API trackable_callback_list
 {
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+
+  /// A handle that does not identify any callback.
+  static constexpr handle_type invalid_handle = static_cast<handle_type>(-1);
+
   /** Add a callback function.
    * @param data Data that will be sent as a parameter to teh callback function.
    * @param func The callback function.
-   *
+   * @return A handle that can be passed to remove_callback().
    */
-  void add_callback(notifiable* data, func_destroy_notify func);
+  handle_type add_callback(notifiable* data, func_destroy_notify func);
 
   /** Remove the callback which has this data associated with it.
    * @param data The data that was given as a parameter to add_callback().
    */
   void remove_callback(notifiable* data);
 
+  /** Remove the callback which has this data associated with it.
+   * @param data The data that was given as a parameter to add_callback().
+   * @param handle The handle that was returned by add_callback().
+   */
+  void remove_callback(notifiable* data, handle_type handle);
+
   /** This invokes all of the callback functions.
    */
   void clear();
 
-  trackable_callback_list() : clearing_(false) {}
+  trackable_callback_list() noexcept;
+
+  /** Constructs a callback list that stores its first callbacks in @a buffer.
+   * @param buffer Uninitialized storage for @a capacity callbacks.
+   *               It must outlive the callback list.
+   * @param capacity The number of callbacks that fit in @a buffer.
+   */
+  trackable_callback_list(void* buffer, size_type capacity) noexcept;
+
+  /** Constructs a callback list that allocates its array from @a resource.
+   * @param resource The memory resource. It must outlive the callback list.
+   */
+  explicit trackable_callback_list(std::pmr::memory_resource* resource) noexcept;
+
+  /** Returns whether the list was constructed with a buffer.
+   * Such a list is owned by a sigc::inline_trackable, not by a sigc::trackable.
+   */
+  inline bool has_inline_buffer() const noexcept { return buffer_ != nullptr; }
+
+  /// Returns the memory resource of the list, or @p nullptr if it uses operator new.
+  inline std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+  /** Creates a callback list in memory from @a resource.
+   * @param resource The memory resource, or @p nullptr to use operator new.
+   * @return The new list. It must be deleted with destroy().
+   */
+  static trackable_callback_list* create(std::pmr::memory_resource* resource);
+
+  /// Deletes a list that has been created with create().
+  static void destroy(trackable_callback_list* list);
 
   trackable_callback_list(const trackable_callback_list& src) = delete;
   trackable_callback_list& operator=(const trackable_callback_list& src) = delete;
@@ -82,8 +141,27 @@ struct SIGC_API trackable_callback_list
   ~trackable_callback_list();
 
 private:
-  using callback_list = std::list<trackable_callback>;
-  callback_list callbacks_;
+  void invoke_callbacks();
+  void remove_at(size_type i) noexcept;
+  void grow();
+  void deallocate_array() noexcept;
+
+  trackable_callback* callbacks_;
+  size_type size_;
+  size_type capacity_;
+
+  /// The buffer that was given to the constructor, if any.
+  trackable_callback* buffer_;
+
+  /// The memory resource of callbacks_ and of the list itself, if any.
+  std::pmr::memory_resource* resource_;
+
+  /// The most recently removed callback in callbacks_, or invalid_handle.
+  size_type free_;
+
+  /// Index of the callback that's being invoked, when clearing_ is true.
+  size_type current_;
+
   bool clearing_;
 };
 
@@ -127,6 +205,14 @@ struct SIGC_API trackable : public notifiable
 
   trackable(trackable&& src) noexcept;
 
+  /** Constructs a trackable whose callback list is allocated from @a resource.
+   * The list is kept until the trackable is destroyed, so that the slots and
+   * connections that track the object don't allocate global memory for it.
+   * Copies and moved-to objects don't use the resource.
+   * @param resource The memory resource. It must outlive the trackable.
+   */
+  explicit trackable(std::pmr::memory_resource* resource);
+
   trackable& operator=(const trackable& src);
 
   trackable& operator=(trackable&& src) noexcept;
@@ -138,12 +224,14 @@ struct SIGC_API trackable : public notifiable
                                   pointer type for their own derived objects */
 
   using func_destroy_notify = internal::func_destroy_notify;
+  using callback_handle = internal::trackable_callback_list::handle_type;
 
   /** Add a callback that is executed (notified) when the trackable object is detroyed.
    * @param data Passed into func upon notification.
    * @param func Callback executed upon destruction of the object.
+   * @return A handle that makes remove_destroy_notify_callback() fast.
    */
-  void add_destroy_notify_callback(notifiable* data, func_destroy_notify func) const;
+  callback_handle add_destroy_notify_callback(notifiable* data, func_destroy_notify func) const;
 
   /** Remove a callback previously installed with add_destroy_notify_callback().
    * The callback is not executed.
@@ -151,19 +239,113 @@ struct SIGC_API trackable : public notifiable
    */
   void remove_destroy_notify_callback(notifiable* data) const;
 
+  /** Remove a callback previously installed with add_destroy_notify_callback().
+   * The callback is not executed.
+   * @param data Parameter passed into previous call to add_destroy_notify_callback().
+   * @param handle The value returned by add_destroy_notify_callback().
+   */
+  void remove_destroy_notify_callback(notifiable* data, callback_handle handle) const;
+
   /// Execute and remove all previously installed callbacks.
   void notify_callbacks();
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
+protected:
+  /* Constructs a trackable that uses a callback list owned by a derived class.
+   * The derived class must call notify_callbacks() and then release_callback_list()
+   * from its destructor, before the list is destroyed.
+   */
+  explicit trackable(internal::trackable_callback_list* list) noexcept;
+
+  inline void release_callback_list() noexcept { callback_list_ = nullptr; }
+
 private:
   /* The callbacks are held in a list of type trackable_callback_list.
-   * This list is allocated dynamically when the first callback is added.
+   * This list is allocated dynamically when the first callback is added,
+   * unless it's owned by an inline_trackable, or allocated from a memory resource.
    */
   internal::trackable_callback_list* callback_list() const;
   mutable internal::trackable_callback_list* callback_list_;
 #endif
 };
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace internal
+{
+
+/** A trackable_callback_list with room for @a N callbacks in the object itself.
+ * It's a base class of inline_trackable, and of the slot_reps of pooled slots,
+ * so that it's constructed before the trackable that uses the list.
+ */
+template<std::size_t N>
+struct inline_callback_list
+{
+  static_assert(N > 0, "An inline callback list needs room for at least one callback.");
+
+  inline_callback_list() noexcept : list_(buffer_, N) {}
+
+  inline_callback_list(const inline_callback_list& src) = delete;
+  inline_callback_list& operator=(const inline_callback_list& src) = delete;
+
+  trackable_callback_list list_;
+
+private:
+  alignas(trackable_callback) unsigned char buffer_[N * sizeof(trackable_callback)];
+};
+
+} /* namespace internal */
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** Trackable with inline storage for its destroy notification callbacks.
+ * inline_trackable can be inherited instead of trackable. It holds the
+ * callback list and room for @a N callbacks in the object itself, so no
+ * memory is allocated until more than @a N slots or connections track the
+ * object at the same time. The price is a bigger object, see test_size.cc.
+ *
+ * Use it for objects that are numerous and have few dependents each.
+ *
+ * @tparam N The number of callbacks that are stored without allocating memory.
+ *
+ * @ingroup signal
+ */
+template<std::size_t N = 2>
+struct inline_trackable
+: private internal::inline_callback_list<N>,
+  public trackable
+{
+  inline_trackable() noexcept : trackable(&this->list_) {}
+
+  // Like trackable, don't copy or move the notification list.
+  inline_trackable(const inline_trackable& /* src */) noexcept
+  : internal::inline_callback_list<N>(), trackable(&this->list_)
+  {
+  }
+
+  inline_trackable(inline_trackable&& src) noexcept
+  : internal::inline_callback_list<N>(), trackable(&this->list_)
+  {
+    src.notify_callbacks();
+  }
+
+  inline_trackable& operator=(const inline_trackable& src)
+  {
+    trackable::operator=(src);
+    return *this;
+  }
+
+  inline_trackable& operator=(inline_trackable&& src) noexcept
+  {
+    trackable::operator=(std::move(src));
+    return *this;
+  }
+
+  ~inline_trackable()
+  {
+    notify_callbacks();
+    release_callback_list();
+  }
+};
+
 } /* namespace sigc */
 
 #endif /* SIGC_TRACKABLE_HPP */
@@ -20,6 +20,7 @@
 #define SIGC_TYPE_TRAIT_H
 
 #include <sigc++config.h>
+#include <type_traits>
 
 namespace sigc
 {
@@ -72,6 +73,15 @@ using type_trait_pass_t = typename type_trait<T>::pass;
 template<typename T>
 using type_trait_take_t = typename type_trait<T>::take;
 
+/** The type of a parameter that takes over an argument of type @e T.
+ * Arguments of class types that are passed by value are taken as rvalue
+ * references, so they can be moved. Other arguments are taken like with
+ * type_trait_take_t.
+ */
+template<typename T>
+using type_trait_take_moving_t =
+  std::conditional_t<std::is_class_v<T>, T&&, type_trait_take_t<T>>;
+
 } /* namespace sigc */
 
 #endif /* SIGC_TYPE_TRAIT_H */
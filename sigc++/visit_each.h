@@ -121,6 +121,11 @@ struct visitor
   {
     action(functor);
   }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+  // Specializations don't define it. See internal::has_trackable_targets.
+  using primary_visitor = void;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
 };
 
 /** This function performs a functor on each of the targets of a functor.
@@ -158,5 +163,29 @@ visit_each_trackable(const T_action& action, const T_functor& functor)
   sigc::visit_each(limited_action, functor);
 }
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace internal
+{
+
+/** Trait that tells whether visit_each_trackable() may find a trackable in a functor.
+ * It's false for a functor type without a visitor specialization that
+ * does not derive from trackable, such as a lambda expression or a function
+ * pointer. visit_each_trackable() then never calls its action.
+ * Any functor type with a visitor specialization may have trackable targets.
+ */
+template<typename T_functor, typename = void>
+struct has_trackable_targets : public std::true_type
+{
+};
+
+template<typename T_functor>
+struct has_trackable_targets<T_functor, std::void_t<typename visitor<T_functor>::primary_visitor>>
+: public std::bool_constant<is_base_of_or_same_v<sigc::trackable, T_functor>>
+{
+};
+
+} /* namespace internal */
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
 } /* namespace sigc */
 #endif
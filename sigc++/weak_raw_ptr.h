@@ -34,33 +34,33 @@ namespace internal
 template<typename T>
 struct weak_raw_ptr : public sigc::notifiable
 {
-  inline weak_raw_ptr() : p_(nullptr) {}
+  inline weak_raw_ptr() : p_(nullptr), handle_(0) {}
 
-  inline weak_raw_ptr(T* p) noexcept : p_(p)
+  inline weak_raw_ptr(T* p) noexcept : p_(p), handle_(0)
   {
     if (!p)
       return;
 
-    p->add_destroy_notify_callback(this, &notify_object_invalidated);
+    handle_ = p->add_destroy_notify_callback(this, &notify_object_invalidated);
   }
 
-  inline weak_raw_ptr(const weak_raw_ptr& src) noexcept : p_(src.p_)
+  inline weak_raw_ptr(const weak_raw_ptr& src) noexcept : p_(src.p_), handle_(0)
   {
     if (p_)
-      p_->add_destroy_notify_callback(this, &notify_object_invalidated);
+      handle_ = p_->add_destroy_notify_callback(this, &notify_object_invalidated);
   }
 
   inline weak_raw_ptr& operator=(const weak_raw_ptr& src) noexcept
   {
     if (p_)
     {
-      p_->remove_destroy_notify_callback(this);
+      p_->remove_destroy_notify_callback(this, handle_);
     }
 
     p_ = src.p_;
 
     if (p_)
-      p_->add_destroy_notify_callback(this, &notify_object_invalidated);
+      handle_ = p_->add_destroy_notify_callback(this, &notify_object_invalidated);
 
     return *this;
   }
@@ -73,7 +73,7 @@ struct weak_raw_ptr : public sigc::notifiable
   {
     if (p_)
     {
-      p_->remove_destroy_notify_callback(this);
+      p_->remove_destroy_notify_callback(this, handle_);
     }
   }
 
@@ -95,6 +95,9 @@ private:
   }
 
   T* p_;
+
+  /// The handle returned by add_destroy_notify_callback(), to remove the callback quickly.
+  trackable::callback_handle handle_;
 };
 
 } /* namespace internal */
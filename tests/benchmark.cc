@@ -2,12 +2,47 @@
  *  Assigned to public domain.  Use as you wish without restriction.
  */
 
+#include <cstdlib>
 #include <iostream>
+#include <new>
+#include <vector>
 #include <sigc++/signal.h>
 #include <sigc++/functors/mem_fun.h>
 #include <boost/timer/timer.hpp>
 
 const int COUNT = 10000000;
+const int MANY_SLOTS = 50;
+
+// Global operator new is replaced by a version that counts the allocations,
+// so the connection benchmarks can show how many of them a cycle does.
+
+// g++ does not know that the replaced operator new calls malloc().
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+long allocations = 0;
+
+void*
+operator new(std::size_t size)
+{
+  ++allocations;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
 
 struct foo : public sigc::trackable
 {
@@ -15,6 +50,18 @@ struct foo : public sigc::trackable
   int c;
 };
 
+struct pooled_foo : public foo
+{
+  int bar(int a);
+};
+
+// Slots of pooled_foo::bar recycle their memory, see test_connect_disconnect_pooled().
+template<>
+struct sigc::slot_rep_pooling<sigc::bound_mem_functor<int (pooled_foo::*)(int), int>>
+: public std::true_type
+{
+};
+
 int
 foo::bar(int a)
 {
@@ -23,6 +70,19 @@ foo::bar(int a)
   return b;
 }
 
+int
+pooled_foo::bar(int a)
+{
+  return foo::bar(a);
+}
+
+void
+print_allocations(long n_allocations)
+{
+  std::cout << "allocations per connection/disconnection: " << double(n_allocations) / COUNT
+            << std::endl;
+}
+
 void
 test_slot_call()
 {
@@ -83,6 +143,23 @@ test_connected_multiple_signal_emit()
     emitter(i);
 }
 
+void
+test_connected_many_signal_emit()
+{
+  std::vector<foo> foobars(MANY_SLOTS);
+
+  sigc::signal<int(int)> emitter;
+  for (auto& foobar : foobars)
+    emitter.connect(mem_fun(foobar, &foo::bar));
+
+  std::cout << "elapsed time for " << COUNT / 10 << " emissions (" << MANY_SLOTS
+            << " slots):" << std::endl;
+  boost::timer::auto_cpu_timer timer;
+
+  for (int i = 0; i < COUNT / 10; ++i)
+    emitter(i);
+}
+
 void
 test_connect_disconnect()
 {
@@ -91,11 +168,65 @@ test_connect_disconnect()
   sigc::connection conn;
 
   std::cout << "elapsed time for " << COUNT << " connections/disconnections:" << std::endl;
+  long n_allocations = 0;
+  {
+    boost::timer::auto_cpu_timer timer;
+    const auto before = allocations;
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+      conn = emitter.connect(mem_fun(foobar1, &foo::bar));
+      conn.disconnect();
+    }
+    n_allocations = allocations - before;
+  }
+  print_allocations(n_allocations);
+}
+
+void
+test_connect_disconnect_pooled()
+{
+  pooled_foo foobar1;
+  sigc::signal<int(int)> emitter;
+  sigc::connection conn;
+
+  // Warm up the cache of the slot_reps.
+  conn = emitter.connect(mem_fun(foobar1, &pooled_foo::bar));
+  conn.disconnect();
+
+  std::cout << "elapsed time for " << COUNT << " connections/disconnections (pooled):" << std::endl;
+  long n_allocations = 0;
+  {
+    boost::timer::auto_cpu_timer timer;
+    const auto before = allocations;
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+      conn = emitter.connect(mem_fun(foobar1, &pooled_foo::bar));
+      conn.disconnect();
+    }
+    n_allocations = allocations - before;
+  }
+  print_allocations(n_allocations);
+}
+
+void
+test_connect_disconnect_many()
+{
+  std::vector<foo> foobars(MANY_SLOTS);
+  sigc::signal<int(int)> emitter;
+  sigc::connection conn;
+
+  for (auto& foobar : foobars)
+    emitter.connect(mem_fun(foobar, &foo::bar));
+
+  std::cout << "elapsed time for " << COUNT << " connections/disconnections (" << MANY_SLOTS
+            << " slots connected):" << std::endl;
   boost::timer::auto_cpu_timer timer;
 
   for (int i = 0; i < COUNT; ++i)
   {
-    conn = emitter.connect(mem_fun(foobar1, &foo::bar));
+    conn = emitter.connect(mem_fun(foobars[i % MANY_SLOTS], &foo::bar));
     conn.disconnect();
   }
 }
@@ -115,6 +246,15 @@ main()
   // emission benchmark (five slot) ...
   test_connected_multiple_signal_emit();
 
+  // emission benchmark (many slots) ...
+  test_connected_many_signal_emit();
+
   // connection / disconnection benchmark ...
   test_connect_disconnect();
+
+  // connection / disconnection benchmark with slot_rep_pooling ...
+  test_connect_disconnect_pooled();
+
+  // connection / disconnection benchmark with other slots connected ...
+  test_connect_disconnect_many();
 }
@@ -0,0 +1,408 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/awaitable.h>
+#include <string>
+
+#ifdef SIGC_HAVE_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// g++ warns about the code that it generates for coroutine frames.
+#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
+#endif
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+// A coroutine that starts immediately and can be destroyed while it's suspended.
+struct task
+{
+  struct promise_type
+  {
+    task get_return_object() { return task(handle_type::from_promise(*this)); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() { std::terminate(); }
+  };
+
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  explicit task(handle_type handle) : handle_(handle) {}
+  task(const task& src) = delete;
+  task& operator=(const task& src) = delete;
+  ~task() { handle_.destroy(); }
+
+  bool done() const { return handle_.done(); }
+
+  handle_type handle_;
+};
+
+task
+wait_for_two(sigc::signal<void(int, const std::string&)>& sig)
+{
+  auto [i, s] = co_await sig.next();
+  result_stream << "first(" << i << ", " << s << ") ";
+  auto [j, t] = co_await sig.next();
+  result_stream << "second(" << j << ", " << t << ") ";
+}
+
+void
+test_next()
+{
+  sigc::signal<void(int, const std::string&)> sig;
+  sig.connect([](int i, const std::string&) { result_stream << "slot(" << i << ") "; });
+
+  task t = wait_for_two(sig);
+  result_stream << sig.size() << " ";
+  sig.emit(1, "a");
+  sig.emit(2, "b");
+  sig.emit(3, "c");
+  result_stream << t.done() << " " << sig.size();
+  util->check_result(result_stream,
+    "2 slot(1) first(1, a) slot(2) second(2, b) slot(3) 1 1");
+}
+
+task
+wait_for_return_value(sigc::signal<int(int)>& sig)
+{
+  auto [i] = co_await sig.next();
+  result_stream << "resumed(" << i << ") ";
+}
+
+void
+test_return_value()
+{
+  // The one-shot slot is invoked last, and returns a default-constructed value.
+  sigc::signal<int(int)> sig;
+  sig.connect([](int i) { return i * 10; });
+  task t = wait_for_return_value(sig);
+  result_stream << sig.emit(4) << " ";
+  result_stream << sig.emit(5);
+  util->check_result(result_stream, "resumed(4) 0 50");
+}
+
+void
+test_destroy_while_suspended()
+{
+  sigc::signal<void(int)> sig;
+  {
+    auto t = [](sigc::signal<void(int)>& s) -> task
+    {
+      co_await s.next();
+      result_stream << "not reached";
+    }(sig);
+    result_stream << sig.size();
+  }
+  result_stream << sig.size();
+  sig.emit(1);
+  util->check_result(result_stream, "10");
+
+  // The signal is destroyed first. The coroutine is not resumed.
+  auto s2 = new sigc::signal<void(int)>();
+  task t = [](sigc::signal<void(int)>& s) -> task
+  {
+    co_await s.next();
+    result_stream << "not reached";
+  }(*s2);
+  delete s2;
+  result_stream << t.done();
+  util->check_result(result_stream, "0");
+}
+
+// An event that coroutines can await, and that is set by the test.
+struct event
+{
+  struct awaiter
+  {
+    bool await_ready() const noexcept { return event_->set_; }
+    void await_suspend(std::coroutine_handle<> handle) { event_->waiters_.push_back(handle); }
+    void await_resume() const noexcept {}
+
+    event* event_;
+  };
+
+  awaiter operator co_await() noexcept { return awaiter{ this }; }
+
+  void set()
+  {
+    set_ = true;
+    for (auto handle : std::exchange(waiters_, {}))
+      handle.resume();
+  }
+
+  bool set_ = false;
+  std::vector<std::coroutine_handle<>> waiters_;
+};
+
+// A coroutine that returns a value, and resumes the coroutine that awaits it.
+template<typename T>
+struct value_task
+{
+  struct promise_type
+  {
+    struct final_awaiter
+    {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+      {
+        const auto continuation = handle.promise().continuation_;
+        return continuation ? continuation : std::noop_coroutine();
+      }
+      void await_resume() const noexcept {}
+    };
+
+    value_task get_return_object() { return value_task(handle_type::from_promise(*this)); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    final_awaiter final_suspend() noexcept { return {}; }
+    void return_value(T value) { value_ = std::move(value); }
+    void unhandled_exception() { exception_ = std::current_exception(); }
+
+    std::optional<T> value_;
+    std::exception_ptr exception_;
+    std::coroutine_handle<> continuation_;
+  };
+
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  explicit value_task(handle_type handle) : handle_(handle) {}
+  value_task(value_task&& src) noexcept : handle_(std::exchange(src.handle_, nullptr)) {}
+  value_task& operator=(value_task&& src) = delete;
+  ~value_task()
+  {
+    if (handle_)
+      handle_.destroy();
+  }
+
+  bool await_ready() const noexcept { return handle_.done(); }
+  void await_suspend(std::coroutine_handle<> continuation) noexcept
+  {
+    handle_.promise().continuation_ = continuation;
+  }
+  T await_resume()
+  {
+    if (handle_.promise().exception_)
+      std::rethrow_exception(handle_.promise().exception_);
+    return std::move(*handle_.promise().value_);
+  }
+
+  handle_type handle_;
+};
+
+struct sum_accumulator
+{
+  template<typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
+
+task
+gather(sigc::signal<value_task<int>(int)>& sig)
+{
+  try
+  {
+    const auto results = co_await sig.emit_async(10);
+    result_stream << "results:";
+    for (const auto result : results)
+      result_stream << " " << result;
+  }
+  catch (const std::exception& e)
+  {
+    result_stream << "exception: " << e.what();
+  }
+}
+
+template<typename T_signal>
+task
+wait_for_next(T_signal& sig)
+{
+  auto [i] = co_await sig.next();
+  result_stream << "next(" << i << ") ";
+}
+
+task
+gather_trackable(sigc::trackable_signal<value_task<int>(int)>& sig)
+{
+  const auto results = co_await sig.emit_async(1);
+  result_stream << "results:";
+  for (const auto result : results)
+    result_stream << " " << result;
+}
+
+void
+test_trackable_signal()
+{
+  sigc::trackable_signal<int(int)> sig;
+  task t = wait_for_next(sig);
+  sig.emit(5);
+  result_stream << t.done() << " " << sig.size();
+  util->check_result(result_stream, "next(5) 1 0");
+
+  sigc::trackable_signal<value_task<int>(int)> async_sig;
+  async_sig.connect([](int i) -> value_task<int> { co_return i + 1; });
+  async_sig.connect([](int i) -> value_task<int> { co_return i + 2; });
+  task t2 = gather_trackable(async_sig);
+  result_stream << " " << t2.done();
+  util->check_result(result_stream, "results: 2 3 1");
+}
+
+void
+test_emit_async()
+{
+  event event1;
+  event event2;
+  sigc::signal<value_task<int>(int)> sig;
+  sig.connect(
+    [&event1](int i) -> value_task<int>
+    {
+      co_await event1;
+      co_return i + 1;
+    });
+  sig.connect([](int i) -> value_task<int> { co_return i + 2; });
+  sig.connect(
+    [&event2](int i) -> value_task<int>
+    {
+      co_await event2;
+      co_return i + 3;
+    });
+
+  // The slots complete in a different order than they are invoked.
+  task t = gather(sig);
+  result_stream << t.done();
+  event2.set();
+  result_stream << t.done() << " ";
+  event1.set();
+  result_stream << " " << t.done();
+  util->check_result(result_stream, "00 results: 12 13 11 1");
+
+  // An exception is rethrown when all slots have completed.
+  event event3;
+  sig.clear();
+  sig.connect(
+    [&event3](int) -> value_task<int>
+    {
+      co_await event3;
+      throw std::runtime_error("slot failed");
+    });
+  sig.connect([](int i) -> value_task<int> { co_return i; });
+  task t2 = gather(sig);
+  result_stream << t2.done() << " ";
+  event3.set();
+  util->check_result(result_stream, "0 exception: slot failed");
+}
+
+task
+accumulate(sigc::signal_with_accumulator<value_task<int>, sum_accumulator, int>& sig)
+{
+  result_stream << "sum: " << co_await sig.emit_async(5);
+}
+
+void
+test_emit_async_accumulator()
+{
+  // All slots complete immediately. The coroutine is not suspended.
+  sigc::signal_with_accumulator<value_task<int>, sum_accumulator, int> sig;
+  for (int n = 1; n <= 3; ++n)
+    sig.connect([n](int i) -> value_task<int> { co_return i * n; });
+  task t = accumulate(sig);
+  result_stream << " " << t.done();
+  util->check_result(result_stream, "sum: 30 1");
+
+  sigc::signal_with_accumulator<value_task<int>, sum_accumulator, int> empty_sig;
+  task t2 = accumulate(empty_sig);
+  util->check_result(result_stream, "sum: 0");
+}
+
+// Returns the first negative result, and ignores the following ones.
+struct first_negative_accumulator
+{
+  template<typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    for (; first != last; ++first)
+    {
+      if (*first < 0)
+        return *first;
+    }
+    return 0;
+  }
+};
+
+task
+find_negative(sigc::signal_with_accumulator<value_task<int>, first_negative_accumulator, int>& sig)
+{
+  result_stream << "first negative: " << co_await sig.emit_async(5);
+}
+
+void
+test_emit_async_short_circuit()
+{
+  // The accumulator gets the results when all slots have completed.
+  // It can't stop the slot that completes after the negative result.
+  event event1;
+  int calls = 0;
+  sigc::signal_with_accumulator<value_task<int>, first_negative_accumulator, int> sig;
+  sig.connect([](int i) -> value_task<int> { co_return -i; });
+  sig.connect(
+    [&event1, &calls](int i) -> value_task<int>
+    {
+      ++calls;
+      co_await event1;
+      co_return i;
+    });
+
+  task t = find_negative(sig);
+  result_stream << t.done() << calls << " ";
+  event1.set();
+  result_stream << " " << t.done();
+  util->check_result(result_stream, "01 first negative: -5 1");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_next();
+  test_return_value();
+  test_destroy_while_suspended();
+  test_emit_async();
+  test_emit_async_accumulator();
+  test_emit_async_short_circuit();
+  test_trackable_signal();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else // !SIGC_HAVE_COROUTINES
+
+int
+main()
+{
+  // The compiler doesn't support C++20 coroutines. Nothing to test.
+  return EXIT_SUCCESS;
+}
+
+#endif // SIGC_HAVE_COROUTINES
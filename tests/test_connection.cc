@@ -6,6 +6,9 @@
 #include <sigc++/trackable.h>
 #include <sigc++/signal.h>
 #include <iostream>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -27,6 +30,157 @@ test_connection_copy_empty()
   std::cout << &con2 << std::endl;
 }
 
+void
+test_connection_copies()
+{
+  static_assert(std::is_nothrow_copy_constructible<sigc::connection>::value &&
+                  std::is_nothrow_copy_assignable<sigc::connection>::value,
+    "Copying a sigc::connection shall not throw.");
+
+  sigc::signal<void(int)> sig;
+  auto conn = sig.connect([](int i) { result_stream << "slot(" << i << ") "; });
+
+  std::vector<sigc::connection> copies(100, conn);
+  result_stream << copies.front().connected() << copies.back().connected();
+  util->check_result(result_stream, "11");
+
+  copies.back().block();
+  sig(1);
+  util->check_result(result_stream, "");
+  result_stream << conn.blocked();
+  util->check_result(result_stream, "1");
+  conn.unblock();
+  sig(2);
+  util->check_result(result_stream, "slot(2) ");
+
+  copies[50].disconnect();
+  result_stream << conn.connected() << copies.front().connected() << sig.size();
+  util->check_result(result_stream, "000");
+  copies.back().disconnect(); // Does nothing.
+}
+
+void
+test_connection_stale()
+{
+  sigc::signal<void()> sig;
+  auto conn1 = sig.connect([]() { result_stream << "slot1 "; });
+  conn1.disconnect();
+
+  // The new slot may reuse the released entry, but conn1 stays stale.
+  auto conn2 = sig.connect([]() { result_stream << "slot2 "; });
+  result_stream << conn1.connected() << conn2.connected();
+  util->check_result(result_stream, "01");
+  conn1.disconnect();
+  sig();
+  util->check_result(result_stream, "slot2 ");
+
+  // The connection outlives the signal.
+  {
+    sigc::signal<void()> sig2;
+    conn1 = sig2.connect([]() {});
+    result_stream << conn1.connected();
+  }
+  result_stream << conn1.connected();
+  util->check_result(result_stream, "10");
+}
+
+void
+test_connection_many()
+{
+  // Enough slots to fill several segments of the table.
+  sigc::signal<void()> sig;
+  std::vector<sigc::connection> conns;
+  for (int i = 0; i < 1000; ++i)
+    conns.push_back(sig.connect([]() {}));
+
+  int connected = 0;
+  for (const auto& conn : conns)
+    connected += conn.connected();
+  for (std::size_t i = 0; i < conns.size(); i += 2)
+    conns[i].disconnect();
+  for (const auto& conn : conns)
+    connected += conn.connected();
+  result_stream << connected << " " << sig.size();
+  util->check_result(result_stream, "1500 500");
+}
+
+void
+test_connection_reclaimed()
+{
+  // The segments of the table that hold these connections are freed when the
+  // signal is destroyed, and allocated again for the next signal.
+  std::vector<sigc::connection> stale;
+  {
+    sigc::signal<void()> sig;
+    for (int i = 0; i < 1000; ++i)
+      stale.push_back(sig.connect([]() {}));
+  }
+
+  sigc::signal<void()> sig;
+  std::vector<sigc::connection> conns;
+  for (int i = 0; i < 1000; ++i)
+    conns.push_back(sig.connect([]() {}));
+
+  int connected = 0;
+  for (const auto& conn : stale)
+    connected += conn.connected();
+  for (const auto& conn : conns)
+    connected += conn.connected();
+  for (auto& conn : stale)
+    conn.disconnect(); // Does nothing.
+  result_stream << connected << " " << sig.size();
+  util->check_result(result_stream, "1000 1000");
+}
+
+void
+test_connection_threads()
+{
+  // Each thread connects and disconnects the slots of its own signal,
+  // with enough slots to grow and shrink the table.
+  std::vector<int> errors(4, 0);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < errors.size(); ++t)
+  {
+    threads.emplace_back([&errors, t]() {
+      sigc::signal<void()> sig;
+      std::vector<sigc::connection> conns;
+      for (int round = 0; round < 50; ++round)
+      {
+        for (int i = 0; i < 200; ++i)
+          conns.push_back(sig.connect([]() {}));
+        for (auto& conn : conns)
+        {
+          errors[t] += !conn.connected();
+          conn.disconnect();
+          errors[t] += conn.connected();
+        }
+        conns.clear();
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  for (const auto error : errors)
+    result_stream << error;
+  util->check_result(result_stream, "0000");
+}
+
+void
+test_connection_moved_slot()
+{
+  // A slot that's moved to another slot_base invalidates its connections,
+  // as it did when connections were notified by the slot_rep.
+  sigc::slot<void()> s1 = []() { result_stream << "s1 "; };
+  sigc::connection conn(s1);
+  result_stream << conn.connected();
+  sigc::slot<void()> s2(std::move(s1));
+  result_stream << conn.connected();
+  util->check_result(result_stream, "10");
+  s2();
+  util->check_result(result_stream, "s1 ");
+}
+
 } // end anonymous namespace
 
 int
@@ -38,6 +192,12 @@ main(int argc, char* argv[])
     return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 
   test_connection_copy_empty();
+  test_connection_copies();
+  test_connection_stale();
+  test_connection_many();
+  test_connection_reclaimed();
+  test_connection_threads();
+  test_connection_moved_slot();
 
   // See also test_disconnection.cc
 
@@ -0,0 +1,201 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/connection_group.h>
+#include <sigc++/signal.h>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+struct A : public sigc::trackable
+{
+  void foo(int i) { result_stream << "A::foo(" << i << ") "; }
+  void bar(int i) { result_stream << "A::bar(" << i << ") "; }
+};
+
+bool reporting = false;
+
+// A functor that reports how many connections of a group are still
+// connected when it's destroyed.
+struct Reporter
+{
+  explicit Reporter(const std::vector<sigc::connection>* conns) : conns_(conns) {}
+  Reporter(const Reporter& src) = default;
+
+  ~Reporter()
+  {
+    if (!reporting)
+      return;
+    int connected = 0;
+    for (const auto& c : *conns_)
+      connected += c.connected();
+    result_stream << connected << " ";
+  }
+
+  void operator()(int) {}
+
+  const std::vector<sigc::connection>* conns_;
+};
+
+void
+test_disconnect()
+{
+  A a;
+  sigc::signal<void(int)> sig1;
+  sigc::signal<void(int)> sig2;
+  sigc::connection_group group;
+  group += sig1.connect(sigc::mem_fun(a, &A::foo));
+  group += sig1.connect(sigc::mem_fun(a, &A::bar));
+  group += sig2.connect(sigc::mem_fun(a, &A::foo));
+  sig1.connect([](int i) { result_stream << "lambda(" << i << ") "; });
+
+  result_stream << group.size();
+  util->check_result(result_stream, "3");
+
+  group.disconnect();
+  result_stream << group.empty() << sig1.size() << sig2.size() << " ";
+  sig1(1);
+  sig2(2);
+  util->check_result(result_stream, "110 lambda(1) ");
+}
+
+void
+test_one_sweep()
+{
+  // All slots are disconnected before the first one is destroyed.
+  sigc::signal<void(int)> sig;
+  std::vector<sigc::connection> conns;
+  sigc::connection_group group;
+  for (int i = 0; i < 3; ++i)
+  {
+    conns.push_back(sig.connect(Reporter(&conns)));
+    group += conns.back();
+  }
+  reporting = true;
+  group.disconnect();
+  reporting = false;
+  util->check_result(result_stream, "0 0 0 ");
+}
+
+void
+test_destructor()
+{
+  A a;
+  sigc::signal<void(int)> sig;
+  {
+    sigc::connection_group group;
+    group += sig.connect(sigc::mem_fun(a, &A::foo));
+    sig(3);
+  }
+  sig(4);
+  util->check_result(result_stream, "A::foo(3) ");
+}
+
+void
+test_stale_connections()
+{
+  sigc::connection_group group;
+  {
+    // The signal is destroyed before the group.
+    sigc::signal<void(int)> sig;
+    group += sig.connect([](int) {});
+    group += sigc::connection();
+  }
+
+  // A slot that's not connected to a signal.
+  // Adding it makes room by forgetting the two empty connections.
+  sigc::slot<void(int)> s = [](int) {};
+  group += sigc::connection(s);
+  result_stream << group.size() << s.empty();
+  group.disconnect();
+  result_stream << s.empty();
+  util->check_result(result_stream, "101");
+}
+
+void
+test_during_emission()
+{
+  sigc::signal<void(int)> sig;
+  sigc::connection_group group;
+  sig.connect([&group](int i) {
+    result_stream << "first(" << i << ") ";
+    group.disconnect();
+  });
+  group += sig.connect([](int i) { result_stream << "second(" << i << ") "; });
+  group += sig.connect([](int i) { result_stream << "third(" << i << ") "; });
+  sig(5);
+  sig(6);
+  result_stream << sig.size();
+  util->check_result(result_stream, "first(5) first(6) 1");
+}
+
+void
+test_move_and_release()
+{
+  A a;
+  sigc::signal<void(int)> sig;
+  sigc::connection_group group1;
+  group1 += sig.connect(sigc::mem_fun(a, &A::foo));
+
+  sigc::connection_group group2(std::move(group1));
+  result_stream << group1.size() << group2.size();
+  util->check_result(result_stream, "01");
+
+  // Move assignment disconnects the previous connections.
+  sigc::connection_group group3;
+  group3 += sig.connect(sigc::mem_fun(a, &A::bar));
+  group3 = std::move(group2);
+  sig(7);
+  util->check_result(result_stream, "A::foo(7) ");
+
+  auto conns = group3.release();
+  result_stream << group3.empty() << conns.size() << conns.front().connected();
+  util->check_result(result_stream, "111");
+}
+
+void
+test_add_forgets_disconnected()
+{
+  sigc::signal<void(int)> sig;
+  sigc::connection_group group;
+  for (int i = 0; i < 100; ++i)
+    group += sig.connect([](int) {});
+  for (int i = 0; i < 100; ++i)
+  {
+    auto c = sig.connect([](int) {});
+    group += c;
+    c.disconnect();
+  }
+  // Connections that were disconnected separately don't accumulate.
+  result_stream << (group.size() < 200) << sig.size();
+  util->check_result(result_stream, "1100");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_disconnect();
+  test_one_sweep();
+  test_destructor();
+  test_stale_connections();
+  test_during_emission();
+  test_move_and_release();
+  test_add_forgets_disconnected();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,158 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/dispatcher.h>
+#include <sigc++/signal.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+class test_dispatcher : public sigc::dispatcher
+{
+public:
+  int wakes = 0;
+
+protected:
+  void wake() noexcept override { ++wakes; }
+};
+
+struct receiver : public sigc::trackable
+{
+  void on_string(const std::string& str) { result_stream << "on_string(" << str << ") "; }
+};
+
+void
+test_queued_call()
+{
+  test_dispatcher disp;
+  receiver r;
+  sigc::signal<void(const std::string&)> sig;
+  sig.connect(sigc::queued(disp, sigc::mem_fun(r, &receiver::on_string)));
+
+  {
+    std::string str = "first";
+    sig(str);
+    str = "changed";
+    sig("second");
+  }
+  result_stream << disp.wakes << " ";
+  util->check_result(result_stream, "1 ");
+
+  // The arguments have been copied.
+  result_stream << disp.dispatch();
+  util->check_result(result_stream, "on_string(first) on_string(second) 2");
+
+  sig("third");
+  result_stream << disp.wakes;
+  util->check_result(result_stream, "2");
+  disp.dispatch();
+  util->check_result(result_stream, "on_string(third) ");
+}
+
+void
+test_rvalue_argument()
+{
+  test_dispatcher disp;
+  sigc::signal<void(std::unique_ptr<int>&&)> sig;
+  sig.connect(sigc::queued(disp, [](std::unique_ptr<int> p) { result_stream << *p; }));
+
+  auto p = std::make_unique<int>(42);
+  sig(std::move(p));
+  result_stream << (p ? "not moved " : "moved ");
+  disp.dispatch();
+  util->check_result(result_stream, "moved 42");
+}
+
+void
+test_discarded_calls()
+{
+  test_dispatcher disp;
+  sigc::signal<void(const std::string&)> sig;
+  {
+    receiver r;
+    sig.connect(sigc::queued(disp, sigc::mem_fun(r, &receiver::on_string)));
+    sig("lost");
+  }
+  result_stream << sig.size() << " ";
+  disp.dispatch();
+  util->check_result(result_stream, "0 ");
+
+  auto conn = sig.connect(sigc::queued(disp, [](const std::string&) { result_stream << "x"; }));
+  sig("lost");
+  conn.disconnect();
+  disp.dispatch();
+  util->check_result(result_stream, "");
+}
+
+#ifdef __linux__
+void
+test_eventfd_dispatcher()
+{
+  sigc::eventfd_dispatcher disp;
+  const int n_threads = 4;
+  const int n_emissions = 10000;
+  int received = 0;
+
+  // A sigc::signal must only be emitted by one thread at a time.
+  // The signals outlive the threads. Queued calls would be discarded if
+  // the slots were destroyed before the calls are dispatched.
+  std::vector<sigc::signal<void(int)>> signals(n_threads);
+  std::vector<std::thread> threads;
+  for (auto& sig : signals)
+  {
+    sig.connect(sigc::queued(disp, [&received](int) { ++received; }));
+    threads.emplace_back(
+      [&sig]()
+      {
+        for (int i = 0; i < n_emissions; ++i)
+          sig(i);
+      });
+  }
+
+  while (received < n_threads * n_emissions)
+  {
+    pollfd pfd{ disp.fd(), POLLIN, 0 };
+    if (poll(&pfd, 1, 1000) > 0)
+      disp.dispatch();
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  result_stream << received << " " << disp.dispatch();
+  util->check_result(result_stream, std::to_string(n_threads * n_emissions) + " 0");
+}
+#endif // __linux__
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_queued_call();
+  test_rvalue_argument();
+  test_discarded_calls();
+#ifdef __linux__
+  test_eventfd_dispatcher();
+#endif
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,168 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/adaptors/bind.h>
+#include <sigc++/keyed_signal.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+struct A : public sigc::trackable
+{
+  void foo(int i) { result_stream << "A::foo(" << i << ") "; }
+};
+
+void
+test_emit_by_key()
+{
+  A a;
+  sigc::keyed_signal<std::string, void(int)> sig;
+  sig.connect("foo", sigc::mem_fun(a, &A::foo));
+  sig.connect("bar", [](int i) { result_stream << "bar(" << i << ") "; });
+  sig.connect("foo", [](int i) { result_stream << "foo(" << i << ") "; });
+
+  sig.emit("foo", 1);
+  sig("bar", 2);
+  sig("baz", 3);
+  result_stream << sig.size("foo") << sig.size("bar") << sig.size("baz");
+  util->check_result(result_stream, "A::foo(1) foo(1) bar(2) 210");
+}
+
+void
+test_return_value()
+{
+  sigc::keyed_signal<int, int(int)> sig;
+  sig.connect(1, [](int i) { return i + 1; });
+  sig.connect(1, [](int i) { return i * 10; });
+  result_stream << sig(1, 5) << " " << sig(2, 5);
+  util->check_result(result_stream, "50 0");
+}
+
+void
+test_disconnect()
+{
+  sigc::keyed_signal<int, void()> sig;
+  auto conn = sig.connect(1, []() { result_stream << "one "; });
+  sig.connect(2, []() { result_stream << "two "; });
+  sig.connect(2, []() { result_stream << "two again "; });
+  {
+    // Slots of objects that are destroyed are removed.
+    A a;
+    sig.connect(3, sigc::bind(sigc::mem_fun(a, &A::foo), 3));
+    sig(3);
+  }
+  util->check_result(result_stream, "A::foo(3) ");
+
+  conn.disconnect();
+  sig(1);
+  sig(3);
+  result_stream << sig.size(1) << sig.size(3) << sig.empty();
+  util->check_result(result_stream, "000");
+
+  sig.clear(2);
+  sig(2);
+  result_stream << sig.empty();
+  util->check_result(result_stream, "1");
+}
+
+void
+test_priority()
+{
+  sigc::keyed_signal<int, void()> sig;
+  sig.connect(1, []() { result_stream << "a "; });
+  sig.connect(1, []() { result_stream << "b "; }, 1);
+  sig.connect(2, []() { result_stream << "c "; }, -1);
+  sig(1);
+  util->check_result(result_stream, "b a ");
+}
+
+void
+test_during_emission()
+{
+  // Slots can connect to other keys, and clear their own key.
+  sigc::keyed_signal<int, void(int)> sig;
+  sig.connect(1, [&sig](int i) {
+    result_stream << "first(" << i << ") ";
+    for (int key = 2; key < 100; ++key)
+      sig.connect(key, [](int) {});
+    sig.clear(1);
+  });
+  sig.connect(1, [](int i) { result_stream << "second(" << i << ") "; });
+  sig(1, 1);
+  sig(1, 2);
+  result_stream << sig.size(1) << sig.size(50);
+  util->check_result(result_stream, "first(1) 01");
+}
+
+void
+test_prune()
+{
+  // Keys whose slots have been disconnected are forgotten, and the others kept.
+  sigc::keyed_signal<int, void(int)> sig;
+  sig.connect(0, [](int i) { result_stream << "zero(" << i << ") "; });
+  for (int key = 1; key < 1000; ++key)
+  {
+    auto conn = sig.connect(key, [](int) { result_stream << "dead "; });
+    conn.disconnect();
+  }
+  sig.connect(1000, [](int i) { result_stream << "last(" << i << ") "; });
+  sig(0, 1);
+  sig(500, 2);
+  sig(1000, 3);
+  result_stream << sig.empty();
+  util->check_result(result_stream, "zero(1) last(3) 0");
+
+  sig.prune();
+  sig(0, 4);
+  sig(1000, 5);
+  result_stream << sig.size(0) << sig.size(500) << sig.size(1000);
+  util->check_result(result_stream, "zero(4) last(5) 101");
+
+  sig.clear(0);
+  sig.clear(1000);
+  sig.prune();
+  result_stream << sig.empty();
+  util->check_result(result_stream, "1");
+}
+
+void
+test_move()
+{
+  sigc::keyed_signal<int, void()> sig1;
+  sig1.connect(1, []() { result_stream << "one "; });
+  sigc::keyed_signal<int, void()> sig2(std::move(sig1));
+  sig2(1);
+  sig2.clear();
+  sig2(1);
+  result_stream << sig2.empty();
+  util->check_result(result_stream, "one 1");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_emit_by_key();
+  test_return_value();
+  test_disconnect();
+  test_priority();
+  test_during_emission();
+  test_prune();
+  test_move();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,194 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+// Signals, slots and trackables can allocate their memory from a memory resource.
+// Global operator new is replaced by a version that counts the allocations.
+
+// g++ does not know that the replaced operator new calls malloc().
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+bool count_allocations = false;
+int allocations = 0;
+} // end anonymous namespace
+
+void*
+operator new(std::size_t size)
+{
+  if (count_allocations)
+    ++allocations;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace
+{
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+// A memory resource that counts the bytes that have not been deallocated.
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocated = 0;
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t /* alignment */) override
+  {
+    allocated += bytes;
+    if (void* p = std::malloc(bytes))
+      return p;
+    throw std::bad_alloc();
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t /* alignment */) override
+  {
+    allocated -= bytes;
+    std::free(p);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+int calls = 0;
+
+struct A : public sigc::trackable
+{
+  explicit A(std::pmr::memory_resource* resource) : sigc::trackable(resource) {}
+
+  void foo(int i) { calls += i; }
+};
+
+void
+test_signal()
+{
+  counting_resource resource;
+  calls = 0;
+  allocations = 0;
+  count_allocations = true;
+  {
+    sigc::signal<void(int)> sig(&resource);
+    for (int i = 0; i < 10; ++i)
+    {
+      sig.connect(sigc::slot<void(int)>(std::allocator_arg, &resource, [](int a) { calls += a; }));
+    }
+    sig.emit(2);
+
+    auto sig2 = sig;
+    sig2.emit(1);
+  }
+  count_allocations = false;
+
+  result_stream << calls << " " << allocations << " " << resource.allocated;
+  util->check_result(result_stream, "30 0 0");
+}
+
+void
+test_copy_to_resource()
+{
+  // A slot that is connected to the signal is copied into the memory resource.
+  counting_resource resource;
+  sigc::signal<void(int)> sig(&resource);
+  sig.connect([](int) {});
+  const auto with_one_slot = resource.allocated;
+
+  sigc::slot<void(int)> sl = [](int) {};
+  sig.connect(sl);
+  result_stream << (resource.allocated > with_one_slot);
+
+  sig.clear();
+  result_stream << (resource.allocated < with_one_slot);
+  util->check_result(result_stream, "11");
+
+  // A copy of a slot from a memory resource is allocated from the same resource.
+  counting_resource slot_resource;
+  sigc::slot<void(int)> sl2(std::allocator_arg, &slot_resource, [](int) {});
+  const auto with_one_copy = slot_resource.allocated;
+  {
+    // The lambda is immutable, so a plain copy shares the original's functor.
+    auto sl3 = sl2;
+    result_stream << (slot_resource.allocated == with_one_copy);
+
+    // A connected copy has its own functor.
+    sigc::signal<void(int)> sig2;
+    sig2.connect(sl3);
+    result_stream << (slot_resource.allocated == 2 * with_one_copy);
+  }
+  result_stream << (slot_resource.allocated == with_one_copy);
+  util->check_result(result_stream, "111");
+}
+
+void
+test_trackable()
+{
+  counting_resource resource;
+  calls = 0;
+  allocations = 0;
+  sigc::signal<void(int)> sig(&resource);
+  {
+    A a(&resource);
+    count_allocations = true;
+    for (int i = 0; i < 10; ++i)
+      sig.connect(sigc::slot<void(int)>(std::allocator_arg, &resource, sigc::mem_fun(a, &A::foo)));
+    sig.emit(1);
+    count_allocations = false;
+
+    // The callback list is kept and reused.
+    a.notify_callbacks();
+    result_stream << sig.size() << " ";
+    sig.connect(sigc::slot<void(int)>(std::allocator_arg, &resource, sigc::mem_fun(a, &A::foo)));
+  }
+  sig.emit(1);
+  result_stream << calls << " " << allocations << " " << sig.size();
+  util->check_result(result_stream, "0 10 0 0");
+
+  sig.clear();
+  sig = sigc::signal<void(int)>();
+  result_stream << resource.allocated;
+  util->check_result(result_stream, "0");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_signal();
+  test_copy_to_resource();
+  test_trackable();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,189 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/mt_signal.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+int
+foo(int i)
+{
+  result_stream << "foo(" << i << ") ";
+  return 1;
+}
+
+int
+bar(int i)
+{
+  result_stream << "bar(" << i << ") ";
+  return 2;
+}
+
+void
+test_simple()
+{
+  sigc::mt_signal<int(int)> sig;
+  result_stream << sig(0);
+  util->check_result(result_stream, "0");
+
+  auto conn1 = sig.connect(sigc::ptr_fun(&foo));
+  auto conn2 = sig.connect_first(sigc::ptr_fun(&bar));
+  result_stream << sig(1) << " " << sig.size();
+  util->check_result(result_stream, "bar(1) foo(1) 1 2");
+
+  result_stream << conn2.block() << " ";
+  result_stream << sig(2) << " ";
+  result_stream << conn2.unblock() << " " << conn2.blocked();
+  util->check_result(result_stream, "0 foo(2) 1 1 0");
+
+  conn1.disconnect();
+  result_stream << conn1.connected() << conn2.connected() << " " << sig(3);
+  util->check_result(result_stream, "01 bar(3) 2");
+
+  sig.clear();
+  result_stream << conn2.connected() << sig.empty() << sig(4);
+  util->check_result(result_stream, "010");
+}
+
+void
+test_modify_during_emission()
+{
+  sigc::mt_signal<void()> sig;
+  sigc::mt_connection conn;
+  conn = sig.connect(
+    [&]()
+    {
+      result_stream << "slot 1, ";
+      conn.disconnect();
+      sig.connect([]() { result_stream << "slot 2, "; });
+    });
+  sig.emit();
+  sig.emit();
+  util->check_result(result_stream, "slot 1, slot 2, ");
+
+  // The connection can outlive the signal.
+  {
+    sigc::mt_signal<void()> sig2;
+    conn = sig2.connect([]() {});
+    result_stream << conn.connected();
+  }
+  result_stream << conn.connected();
+  conn.disconnect();
+  util->check_result(result_stream, "10");
+}
+
+void
+test_threads()
+{
+  // Emit from several threads while slots are connected and disconnected.
+  sigc::mt_signal<void()> sig;
+  std::atomic<int> permanent_calls(0);
+  std::atomic<int> transient_calls(0);
+  sig.connect([&permanent_calls]() { ++permanent_calls; });
+
+  const int n_threads = 4;
+  const int n_emissions = 20000;
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < n_threads; ++t)
+  {
+    threads.emplace_back(
+      [&sig, &start]()
+      {
+        while (!start)
+          std::this_thread::yield();
+        for (int i = 0; i < n_emissions; ++i)
+          sig.emit();
+      });
+  }
+
+  start = true;
+  for (int i = 0; i < 2000; ++i)
+  {
+    auto conn = sig.connect([&transient_calls]() { ++transient_calls; });
+    conn.disconnect();
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  result_stream << permanent_calls << " " << sig.size();
+  util->check_result(result_stream, std::to_string(n_threads * n_emissions) + " 1");
+}
+
+struct counted
+{
+  counted() { ++instances; }
+  counted(const counted&) { ++instances; }
+  ~counted() { --instances; }
+
+  void operator()(int) const {}
+
+  static std::atomic<int> instances;
+};
+
+std::atomic<int> counted::instances(0);
+
+void
+test_overlapping_emissions()
+{
+  // A disconnected slot is deleted when the emissions that use it have
+  // finished, even if an emission that started later is still running.
+  sigc::mt_signal<void(int)> sig;
+  std::atomic<bool> entered[2] = { false, false };
+  std::atomic<bool> released[2] = { false, false };
+  sig.connect(
+    [&entered, &released](int i)
+    {
+      entered[i] = true;
+      while (!released[i])
+        std::this_thread::yield();
+    });
+  auto conn = sig.connect(counted());
+
+  std::thread t0([&sig]() { sig.emit(0); });
+  while (!entered[0])
+    std::this_thread::yield();
+
+  // t0's snapshot is retired. It still refers to the counted slot.
+  conn.disconnect();
+  std::thread t1([&sig]() { sig.emit(1); });
+  while (!entered[1])
+    std::this_thread::yield();
+  result_stream << counted::instances << " ";
+
+  released[0] = true;
+  t0.join();
+  result_stream << counted::instances;
+
+  released[1] = true;
+  t1.join();
+  util->check_result(result_stream, "1 0");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_simple();
+  test_modify_during_emission();
+  test_threads();
+  test_overlapping_emissions();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -159,6 +159,106 @@ test_clear_called_outside_signal_handler()
   util->check_result(result_stream, "3, slot 1, slot 2, slot 3, 0");
 }
 
+void
+test_single_slot()
+{
+  // A signal with one slot is emitted without walking the list of slots.
+  // The slot can still modify the signal.
+  sigc::signal<int(int)> sig;
+  sigc::connection conn;
+  conn = sig.connect(
+    [&sig, &conn](int i)
+    {
+      result_stream << "slot 1(" << i << "), ";
+      sig.connect(
+        [](int j)
+        {
+          result_stream << "slot 2(" << j << "), ";
+          return 2;
+        });
+      conn.disconnect();
+      return 1;
+    });
+  result_stream << sig(1) << ", ";
+  result_stream << sig(2) << ", " << sig.size();
+  util->check_result(result_stream, "slot 1(1), 1, slot 2(2), 2, 1");
+
+  // A signal that's emitted from its only slot.
+  sigc::signal<void(int)> sig2;
+  sig2.connect(
+    [&sig2](int i)
+    {
+      result_stream << i << " ";
+      if (i > 0)
+        sig2(i - 1);
+    });
+  sig2.emit(2);
+  util->check_result(result_stream, "2 1 0 ");
+
+  sig2.block();
+  sig2.emit(1);
+  util->check_result(result_stream, "");
+}
+
+void
+test_signal_deleted_in_signal_handler()
+{
+  // The signal_impl is deleted when the emission has finished.
+  {
+    auto sig = std::make_unique<sigc::signal<void()>>();
+    sig->connect(
+      [&sig]()
+      {
+        sig.reset();
+        result_stream << "slot 1";
+      });
+    sig->emit();
+    util->check_result(result_stream, "slot 1");
+  }
+  {
+    auto sig = std::make_unique<sigc::signal<void()>>();
+    sig->connect(
+      [&sig]()
+      {
+        sig.reset();
+        result_stream << "slot 1, ";
+      });
+    sig->connect([]() { result_stream << "slot 2"; });
+    sig->emit();
+    util->check_result(result_stream, "slot 1, slot 2");
+  }
+}
+
+void
+test_connect_during_emission_with_priorities()
+{
+  // A slot that's connected during signal emission is not invoked until the
+  // next emission, even if it's placed before slots with a lower priority.
+  sigc::signal<void()> sig;
+  bool connected = false;
+  sig.connect([]() { result_stream << "p10 "; }, 10);
+  sig.connect(
+    [&sig, &connected]()
+    {
+      result_stream << "p0 ";
+      if (connected)
+        return;
+      connected = true;
+      sig.connect([]() { result_stream << "back "; });
+      sig.connect_first([]() { result_stream << "first "; });
+      sig.connect([]() { result_stream << "p5 "; }, 5);
+      sig.connect([]() { result_stream << "p-5b "; }, -5);
+      sig.connect([]() { result_stream << "p-10 "; }, -10);
+    });
+  sig.connect([]() { result_stream << "p-5 "; }, -5);
+
+  sig.emit();
+  util->check_result(result_stream, "p10 p0 p-5 ");
+
+  sig.emit();
+  util->check_result(result_stream, "p10 p5 first p0 back p-5 p-5b p-10 ");
+}
+
 } // end anonymous namespace
 
 int
@@ -177,6 +277,9 @@ main(int argc, char* argv[])
   test_make_slot();
   test_clear_called_in_signal_handler();
   test_clear_called_outside_signal_handler();
+  test_single_slot();
+  test_signal_deleted_in_signal_handler();
+  test_connect_during_emission_with_priorities();
 
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
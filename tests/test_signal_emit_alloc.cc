@@ -0,0 +1,187 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <sigc++/adaptors/retype_return.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <new>
+
+// Signal emission shall not allocate memory.
+// Global operator new is replaced by a version that counts the allocations.
+
+// g++ does not know that the replaced operator new calls malloc(), and warns
+// when it sees the replaced operator delete free the memory after inlining.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+bool count_allocations = false;
+int allocations = 0;
+} // end anonymous namespace
+
+void*
+operator new(std::size_t size)
+{
+  if (count_allocations)
+    ++allocations;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace
+{
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+// The slots must not allocate memory. They don't write to result_stream.
+int calls = 0;
+
+struct A : public sigc::trackable
+{
+  int foo(int i)
+  {
+    ++calls;
+    return i + 1;
+  }
+
+  void baz(int) { ++calls; }
+};
+
+int
+bar(int i)
+{
+  ++calls;
+  return i * 2;
+}
+
+struct sum_accumulator
+{
+  template<typename T_iterator>
+  int operator()(T_iterator first, T_iterator last) const
+  {
+    int sum = 0;
+    for (; first != last; ++first)
+      sum += *first;
+    return sum;
+  }
+};
+
+template<typename T_functor>
+void
+check_no_allocation(const T_functor& emit, const std::string& name)
+{
+  calls = 0;
+  allocations = 0;
+  count_allocations = true;
+  emit();
+  count_allocations = false;
+  result_stream << name << ": " << calls << " calls, " << allocations << " allocations";
+}
+
+void
+test_empty_signal()
+{
+  sigc::signal<int(int)> sig;
+  check_no_allocation([&sig]() { sig(1); }, "empty signal");
+  util->check_result(result_stream, "empty signal: 0 calls, 0 allocations");
+}
+
+void
+test_one_slot()
+{
+  A a;
+  sigc::signal<int(int)> sig;
+  sig.connect(sigc::mem_fun(a, &A::foo));
+  check_no_allocation([&sig]() { sig(2); }, "one slot");
+  util->check_result(result_stream, "one slot: 1 calls, 0 allocations");
+}
+
+void
+test_several_slots()
+{
+  A a;
+  sigc::signal<void(int)> sig;
+  sig.connect(sigc::mem_fun(a, &A::baz));
+  sig.connect(sigc::hide_return(sigc::ptr_fun(&bar)));
+  sig.connect([](int) { ++calls; });
+  check_no_allocation([&sig]() { sig(3); }, "several slots");
+  util->check_result(result_stream, "several slots: 3 calls, 0 allocations");
+}
+
+void
+test_accumulator()
+{
+  A a;
+  sigc::signal<int(int)>::accumulated<sum_accumulator> sig;
+  sig.connect(sigc::mem_fun(a, &A::foo));
+  sig.connect(sigc::ptr_fun(&bar));
+  int result = 0;
+  check_no_allocation([&sig, &result]() { result = sig(4); }, "accumulator");
+  util->check_result(result_stream, "accumulator: 2 calls, 0 allocations");
+  result_stream << result;
+  util->check_result(result_stream, "13");
+}
+
+void
+test_connect_during_emission()
+{
+  // A slot connected during emission is not called until the next emission.
+  sigc::signal<void(int)> sig;
+  sig.connect([&sig](int i) {
+    result_stream << "connector(" << i << ") ";
+    sig.connect([](int j) { result_stream << "connected(" << j << ") "; });
+  });
+  sig(5);
+  util->check_result(result_stream, "connector(5) ");
+  sig.clear();
+
+  sig.connect([](int i) { result_stream << "first(" << i << ") "; });
+  sig(6);
+  util->check_result(result_stream, "first(6) ");
+
+  sig.connect([&sig](int i) {
+    result_stream << "connect_first(" << i << ") ";
+    sig.connect_first([](int j) { result_stream << "prepended(" << j << ") "; });
+  });
+  sig(7);
+  util->check_result(result_stream, "first(7) connect_first(7) ");
+  sig(8);
+  util->check_result(result_stream, "prepended(8) first(8) connect_first(8) ");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_empty_signal();
+  test_one_slot();
+  test_several_slots();
+  test_accumulator();
+  test_connect_during_emission();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
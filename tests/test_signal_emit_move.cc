@@ -0,0 +1,241 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/adaptors/bind.h>
+#include <sigc++/adaptors/hide.h>
+#include <sigc++/adaptors/track_obj.h>
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+struct payload
+{
+  payload() : data{ 1, 2, 3 } {}
+  payload(const payload& src) : data(src.data) { ++copies; }
+  payload(payload&& src) noexcept : data(std::move(src.data)) { ++moves; }
+
+  payload& operator=(const payload& src) = delete;
+  payload& operator=(payload&& src) = delete;
+
+  std::vector<int> data;
+
+  static int copies;
+  static int moves;
+};
+
+int payload::copies = 0;
+int payload::moves = 0;
+
+void
+reset_counters()
+{
+  payload::copies = 0;
+  payload::moves = 0;
+}
+
+void
+inspect(const payload& p)
+{
+  result_stream << "inspect(" << p.data.size() << ") ";
+}
+
+void
+take(payload p)
+{
+  result_stream << "take(" << p.data.size() << ") ";
+}
+
+void
+take_with(payload p, int i)
+{
+  result_stream << "take_with(" << p.data.size() << ", " << i << ") ";
+}
+
+struct Store : public sigc::trackable
+{
+  void take(payload p) { stored.push_back(std::move(p)); }
+  void take_with(payload p, int i)
+  {
+    result_stream << "Store::take_with(" << i << ") ";
+    stored.push_back(std::move(p));
+  }
+
+  std::vector<payload> stored;
+};
+
+void
+test_emit_move()
+{
+  sigc::signal<void(payload)> sig;
+  sig.connect(&take);
+  sig.connect(&inspect);
+  sig.connect(&take);
+
+  reset_counters();
+  sig.emit(payload());
+  result_stream << payload::copies << " ";
+  util->check_result(result_stream, "take(3) inspect(3) take(3) 2 ");
+
+  // Only the last slot takes over the argument.
+  reset_counters();
+  sig.emit_move(payload());
+  result_stream << payload::copies << payload::moves;
+  util->check_result(result_stream, "take(3) inspect(3) take(3) 11");
+
+  // The argument is moved into the last slot that is invoked.
+  sigc::signal<void(payload)> sig2;
+  sig2.connect(&take);
+  auto conn = sig2.connect(&take);
+  conn.block();
+  reset_counters();
+  sig2.emit_move(payload());
+  result_stream << payload::copies << payload::moves;
+  util->check_result(result_stream, "take(3) 01");
+
+  // A single slot.
+  conn.disconnect();
+  reset_counters();
+  sig2.emit_move(payload());
+  result_stream << payload::copies << payload::moves;
+  util->check_result(result_stream, "take(3) 01");
+}
+
+void
+test_block_during_emission()
+{
+  // A slot that is blocked by an earlier slot is not invoked.
+  sigc::signal<void(payload)> sig;
+  sigc::connection conn;
+  sig.connect([&conn](const payload&) {
+    result_stream << "first ";
+    conn.block();
+  });
+  conn = sig.connect(&take);
+  sig.emit_move(payload());
+  util->check_result(result_stream, "first ");
+}
+
+void
+test_unblock_during_emission()
+{
+  // A slot that is unblocked by an earlier slot is invoked, as in emit().
+  sigc::signal<void(payload)> sig;
+  sigc::connection conn;
+  sig.connect([&conn](const payload& p) {
+    result_stream << "first(" << p.data.size() << ") ";
+    conn.unblock();
+  });
+  conn = sig.connect(&take);
+  conn.block();
+  sig.connect(&take);
+
+  reset_counters();
+  sig.emit_move(payload());
+  result_stream << payload::copies << payload::moves;
+  util->check_result(result_stream, "first(3) take(3) take(3) 11");
+}
+
+void
+test_adaptors()
+{
+  // Adaptors get const references to the arguments. Their slots compile,
+  // even if the adapted functor can't take the arguments as rvalues.
+  sigc::signal<void(payload)> sig;
+  Store store;
+  sig.connect(sigc::bind(sigc::ptr_fun(&take_with), 1));
+  sig.connect(sigc::bind(sigc::mem_fun(store, &Store::take_with), 2));
+  sig.connect(sigc::bind<0>([](int i, payload p) { take_with(std::move(p), i); }, 3));
+  sig.connect(sigc::track_obj([](payload p) { take(std::move(p)); }, store));
+  sig.connect(sigc::hide([]() { result_stream << "hide "; }));
+
+  reset_counters();
+  sig.emit(payload());
+  result_stream << payload::copies << " ";
+  util->check_result(
+    result_stream, "take_with(3, 1) Store::take_with(2) take_with(3, 3) take(3) hide 4 ");
+
+  reset_counters();
+  sig.emit_move(payload());
+  result_stream << payload::copies << " " << store.stored.size();
+  util->check_result(
+    result_stream, "take_with(3, 1) Store::take_with(2) take_with(3, 3) take(3) hide 4 2");
+}
+
+void
+test_return_value()
+{
+  sigc::signal<std::size_t(std::string, int)> sig;
+  sig.connect([](const std::string& s, int i) { return s.size() + i; });
+  std::string stored;
+  sig.connect([&stored](std::string s, int) {
+    stored = std::move(s);
+    return stored.size();
+  });
+
+  std::string text(100, 'x');
+  result_stream << sig.emit_move(std::move(text), 1) << " " << stored.size();
+  util->check_result(result_stream, "100 100");
+}
+
+void
+test_reference_arguments()
+{
+  // Reference arguments are passed on as usual. A functor that can't take an
+  // rvalue gets a const reference.
+  sigc::signal<void(payload, int&)> sig;
+  sig.connect([](auto& p, int& i) { i += static_cast<int>(p.data.size()); });
+  sig.connect([](payload p, int& i) { i += static_cast<int>(p.data.size()); });
+  sig.connect([](auto& p, int& i) { i += static_cast<int>(p.data.size()); });
+
+  int i = 0;
+  reset_counters();
+  sig.emit_move(payload(), i);
+  result_stream << i << " " << payload::copies << payload::moves;
+  util->check_result(result_stream, "9 10");
+}
+
+void
+test_trackable_signal()
+{
+  sigc::trackable_signal<void(payload)> sig;
+  Store store;
+  sig.connect(&inspect);
+  sig.connect(sigc::mem_fun(store, &Store::take));
+
+  reset_counters();
+  sig.emit_move(payload());
+  result_stream << store.stored.size() << payload::copies;
+  util->check_result(result_stream, "inspect(3) 10");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_emit_move();
+  test_block_during_emission();
+  test_unblock_during_emission();
+  test_adaptors();
+  test_return_value();
+  test_reference_arguments();
+  test_trackable_signal();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,127 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+sigc::slot<void()>
+printer(const std::string& name)
+{
+  return [name]() { result_stream << name << " "; };
+}
+
+void
+test_order()
+{
+  sigc::signal<void()> sig;
+  sig.connect(printer("a0"));
+  sig.connect(printer("b-1"), -1);
+  sig.connect(printer("c5"), 5);
+  sig.connect(printer("d0"));
+  sig.connect(printer("e5"), 5);
+  sig.connect(printer("f2"), 2);
+  sig.connect_first(printer("g0"));
+  sig.connect(printer("h-1"), -1);
+  sig.connect(printer("i0"), 0);
+  sig.connect(printer("j-3"), -3);
+  sig.connect(printer("k10"), 10);
+  sig();
+  util->check_result(result_stream, "k10 c5 e5 f2 g0 a0 d0 i0 b-1 h-1 j-3 ");
+}
+
+void
+test_without_priority()
+{
+  // connect() and connect_first() behave as before.
+  sigc::signal<void()> sig;
+  sig.connect(printer("a"));
+  sig.connect_first(printer("b"));
+  sig.connect(printer("c"));
+  sig();
+  util->check_result(result_stream, "b a c ");
+}
+
+void
+test_disconnect()
+{
+  sigc::signal<void()> sig;
+  std::vector<sigc::connection> conns;
+  conns.push_back(sig.connect(printer("a5"), 5));
+  conns.push_back(sig.connect(printer("b5"), 5));
+  conns.push_back(sig.connect(printer("c5"), 5));
+  conns.push_back(sig.connect(printer("d-5"), -5));
+  sig.connect(printer("e0"));
+
+  // Remove the first and the last slot of a group, and a whole group.
+  conns[0].disconnect();
+  conns[2].disconnect();
+  conns[3].disconnect();
+  sig.connect(printer("f5"), 5);
+  sig.connect_first(printer("g0"));
+  sig.connect(printer("h-5"), -5);
+  sig();
+  util->check_result(result_stream, "b5 f5 g0 e0 h-5 ");
+
+  // Empty the group with priority 5. It's added again at the right place.
+  conns[1].disconnect();
+  sig.clear();
+  sig.connect(printer("i0"));
+  sig.connect(printer("j5"), 5);
+  sig.connect(printer("k-5"), -5);
+  sig();
+  util->check_result(result_stream, "j5 i0 k-5 ");
+}
+
+void
+test_connect_during_emission()
+{
+  // A slot connected during emission is not called until the next emission,
+  // whatever its priority.
+  sigc::signal<void()> sig;
+  bool connected = false;
+  sig.connect(printer("a5"), 5);
+  sig.connect(
+    [&sig, &connected]() {
+      result_stream << "b-1 ";
+      if (connected)
+        return;
+      connected = true;
+      sig.connect(printer("c5"), 5);
+      sig.connect(printer("d-1"), -1);
+      sig.connect(printer("e0"));
+      sig.connect(printer("f10"), 10);
+    },
+    -1);
+  sig();
+  util->check_result(result_stream, "a5 b-1 ");
+  sig();
+  util->check_result(result_stream, "f10 a5 c5 e0 b-1 d-1 ");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_order();
+  test_without_priority();
+  test_disconnect();
+  test_connect_during_emission();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -35,6 +35,8 @@ main(int argc, char* argv[])
     // libsigc++ 3.0: 8
     std::cout << "  trackable:               " << sizeof(sigc::trackable) << std::endl;
 
+    std::cout << "  inline_trackable<2>:     " << sizeof(sigc::inline_trackable<2>) << std::endl;
+
     // libsigc++ 2.10: 16
     // libsigc++ 3.0: 16
     std::cout << "  slot<void()>:              " << sizeof(sigc::slot<void()>) << std::endl;
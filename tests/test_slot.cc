@@ -3,6 +3,7 @@
  */
 
 #include "testutilities.h"
+#include <sigc++/functors/mem_fun.h>
 #include <sigc++/functors/slot.h>
 
 // The Tru64 compiler seems to need this to avoid an unresolved symbol
@@ -85,6 +86,50 @@ test_copy_ctor()
   util->check_result(result_stream, "foo(int 4)");
 }
 
+struct counted
+{
+  counted() { ++instances; }
+  counted(const counted&) { ++instances; }
+  ~counted() { --instances; }
+
+  void operator()(int i) const { result_stream << "counted(int " << i << ")"; }
+
+  static int instances;
+};
+
+int counted::instances = 0;
+
+struct A : public sigc::trackable
+{
+  void bar(int) {}
+};
+
+static_assert(!sigc::internal::has_trackable_targets<counted>::value);
+static_assert(!sigc::internal::has_trackable_targets<void (*)(int)>::value);
+static_assert(sigc::internal::has_trackable_targets<A>::value);
+static_assert(sigc::internal::has_trackable_targets<decltype(sigc::mem_fun(
+    std::declval<A&>(), &A::bar))>::value);
+
+void
+test_untracked_functor()
+{
+  // A functor without trackable targets lives as long as its slot_rep.
+  // counted is not marked with sigc::slot_rep_sharing, so s2 has its own copy.
+  {
+    sigc::slot<void(int)> s1 = counted();
+    sigc::slot<void(int)> s2 = s1;
+    s2(5);
+    result_stream << " " << counted::instances;
+    s1 = sigc::slot<void(int)>();
+    result_stream << counted::instances;
+    // A slot without a parent keeps its functor until it's destroyed.
+    s2.disconnect();
+    result_stream << counted::instances << s2.empty();
+  }
+  result_stream << counted::instances;
+  util->check_result(result_stream, "counted(int 5) 21110");
+}
+
 } // end anonymous namespace
 
 int
@@ -100,6 +145,7 @@ main(int argc, char* argv[])
   test_reference();
   test_operator_equals();
   test_copy_ctor();
+  test_untracked_functor();
 
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,155 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+struct A : public sigc::trackable
+{
+};
+
+// A move-only functor that is bound to a trackable.
+struct move_only_functor
+{
+  move_only_functor(A& a, int i) : a_(a), value_(std::make_unique<int>(i)) {}
+  move_only_functor(move_only_functor&& src) = default;
+  move_only_functor(const move_only_functor& src) = delete;
+
+  void operator()(int i) const { result_stream << "move_only_functor(" << *value_ + i << ") "; }
+
+  A& a_;
+  std::unique_ptr<int> value_;
+};
+
+} // end anonymous namespace
+
+namespace sigc
+{
+template<>
+struct visitor<move_only_functor>
+{
+  template<typename T_action>
+  static void do_visit_each(const T_action& action, const move_only_functor& target)
+  {
+    sigc::visit_each(action, target.a_);
+  }
+};
+} // namespace sigc
+
+namespace
+{
+
+void
+test_slot()
+{
+  auto value = std::make_unique<int>(10);
+  sigc::slot<void(int)> s1 = [value = std::move(value)](int i) {
+    result_stream << "lambda(" << *value + i << ") ";
+  };
+  s1(1);
+
+  sigc::slot<void(int)> s2(std::move(s1));
+  s2(2);
+  result_stream << s1.empty();
+  util->check_result(result_stream, "lambda(11) lambda(12) 1");
+
+  // Copying the functor is impossible.
+  try
+  {
+    sigc::slot<void(int)> s3(s2);
+    result_stream << "copied ";
+  }
+  catch (const std::logic_error&)
+  {
+    result_stream << "not copied ";
+  }
+  s2(3);
+  util->check_result(result_stream, "not copied lambda(13) ");
+}
+
+void
+test_connect()
+{
+  sigc::signal<void(int)> sig;
+  sig.connect([value = std::make_unique<int>(20)](int i) {
+    result_stream << "lambda(" << *value + i << ") ";
+  });
+
+  sigc::slot<void(int)> s = [value = std::make_unique<int>(30)](int i) {
+    result_stream << "slot(" << *value + i << ") ";
+  };
+  sig.connect(std::move(s), 1);
+  sig(1);
+  util->check_result(result_stream, "slot(31) lambda(21) ");
+
+  // connect(const slot_type&) copies the slot.
+  sigc::slot<void(int)> s2 = [value = std::make_unique<int>(0)](int) {};
+  try
+  {
+    sig.connect(s2);
+    result_stream << "copied";
+  }
+  catch (const std::logic_error&)
+  {
+    result_stream << "not copied";
+  }
+  result_stream << sig.size();
+  util->check_result(result_stream, "not copied2");
+}
+
+void
+test_trackable()
+{
+  sigc::signal<void(int)> sig;
+  {
+    A a;
+    sig.connect(move_only_functor(a, 40));
+    sig(1);
+  }
+  sig(2);
+  result_stream << sig.size();
+  util->check_result(result_stream, "move_only_functor(41) 0");
+}
+
+void
+test_memory_resource()
+{
+  std::pmr::monotonic_buffer_resource resource;
+  sigc::slot<void(int)> s(std::allocator_arg,
+    &resource,
+    [value = std::make_unique<int>(50)](int i) { result_stream << "pmr(" << *value + i << ") "; });
+  sigc::signal<void(int)> sig;
+  sig.connect(std::move(s));
+  sig(1);
+  util->check_result(result_stream, "pmr(51) ");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_slot();
+  test_connect();
+  test_trackable();
+  test_memory_resource();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,164 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <new>
+
+// Slots whose functor type is marked with sigc::slot_rep_pooling recycle
+// their memory. Connecting and disconnecting them shall not allocate memory
+// once the caches are warm.
+// Global operator new is replaced by a version that counts the allocations.
+
+// g++ does not know that the replaced operator new calls malloc().
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+bool count_allocations = false;
+int allocations = 0;
+} // end anonymous namespace
+
+void*
+operator new(std::size_t size)
+{
+  if (count_allocations)
+    ++allocations;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace
+{
+struct A : public sigc::trackable
+{
+  int foo(int i);
+  int bar(int i);
+};
+
+} // end anonymous namespace
+
+template<>
+struct sigc::slot_rep_pooling<sigc::bound_mem_functor<int (A::*)(int), int>> : public std::true_type
+{
+};
+
+namespace
+{
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+int
+A::foo(int i)
+{
+  result_stream << "A::foo(" << i << ") ";
+  return i;
+}
+
+int
+A::bar(int i)
+{
+  result_stream << "A::bar(" << i << ") ";
+  return -i;
+}
+
+void
+connect_disconnect(sigc::signal<int(int)>& sig, A& a, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    auto conn = sig.connect(sigc::mem_fun(a, &A::foo));
+    conn.disconnect();
+  }
+}
+
+void
+test_no_allocation()
+{
+  A a;
+  sigc::signal<int(int)> sig;
+
+  // Warm up the caches.
+  connect_disconnect(sig, a, 10);
+
+  allocations = 0;
+  count_allocations = true;
+  connect_disconnect(sig, a, 1000);
+  count_allocations = false;
+  result_stream << "pooled: " << allocations << " allocations";
+  util->check_result(result_stream, "pooled: 0 allocations");
+}
+
+void
+test_pooled_slot()
+{
+  A a;
+  sigc::signal<int(int)> sig;
+  auto conn = sig.connect(sigc::mem_fun(a, &A::foo));
+  sig.connect(sigc::mem_fun(a, &A::bar));
+  sig(1);
+  util->check_result(result_stream, "A::foo(1) A::bar(1) ");
+
+  // Copies of a pooled slot are pooled slots.
+  sigc::slot<int(int)> s1 = sigc::mem_fun(a, &A::foo);
+  sigc::slot<int(int)> s2 = s1;
+  result_stream << s2(2);
+  util->check_result(result_stream, "A::foo(2) 2");
+
+  conn.disconnect();
+  sig(3);
+  util->check_result(result_stream, "A::bar(3) ");
+}
+
+void
+test_destroy_trackable()
+{
+  sigc::signal<int(int)> sig;
+  sigc::slot<int(int)> s;
+  sigc::connection conn;
+  {
+    A a;
+    s = sigc::mem_fun(a, &A::foo);
+    conn = sig.connect(s);
+    result_stream << sig(4);
+    util->check_result(result_stream, "A::foo(4) 4");
+  }
+  // The slots are invalidated when the trackable is destroyed.
+  result_stream << s.empty() << conn.connected() << sig.size();
+  util->check_result(result_stream, "100");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_no_allocation();
+  test_pooled_slot();
+  test_destroy_trackable();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
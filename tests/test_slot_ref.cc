@@ -0,0 +1,158 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/functors/functors.h>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+using ref_type = sigc::slot_ref<int(int)>;
+static_assert(std::is_trivially_copyable_v<ref_type>, "slot_ref shall be trivially copyable.");
+
+int
+times_two(int i)
+{
+  return 2 * i;
+}
+
+struct A
+{
+  int foo(int i) { return i + 100; }
+};
+
+struct Counter
+{
+  int operator()(int i) { return count_ += i; }
+  int operator()(int i) const { return -i; }
+
+  int count_ = 0;
+};
+
+// Only functors with a matching signature convert to a slot_ref.
+static_assert(std::is_convertible_v<decltype(&times_two), ref_type>);
+static_assert(std::is_convertible_v<Counter&, ref_type>);
+static_assert(!std::is_convertible_v<int, ref_type>);
+static_assert(!std::is_convertible_v<void (*)(const std::string&), ref_type>);
+static_assert(!std::is_convertible_v<std::string (*)(int), ref_type>);
+
+// A function that takes a callback, and calls it before it returns.
+int
+sum(int n, ref_type func)
+{
+  int result = 0;
+  for (int i = 1; i <= n; ++i)
+    result += func(i);
+  return result;
+}
+
+void
+test_functors()
+{
+  result_stream << sum(3, [](int i) { return i * i; }) << " ";
+  result_stream << sum(3, times_two) << " ";
+  result_stream << sum(3, &times_two) << " ";
+
+  A a;
+  result_stream << sum(1, sigc::mem_fun(a, &A::foo)) << " ";
+
+  sigc::slot<int(int)> s = [](int i) { return i + 1; };
+  result_stream << sum(2, s);
+  util->check_result(result_stream, "14 12 12 101 5");
+}
+
+void
+test_reference()
+{
+  // The referenced functor is not copied. Its constness is respected.
+  Counter counter;
+  sum(3, counter);
+  result_stream << counter.count_ << " ";
+
+  const Counter& const_counter = counter;
+  result_stream << sum(3, const_counter) << " " << counter.count_ << " ";
+
+  int calls = 0;
+  auto lambda = [calls](int) mutable { return ++calls; };
+  sum(2, lambda);
+  result_stream << lambda(0);
+  util->check_result(result_stream, "6 -6 6 3");
+}
+
+void
+test_copy_and_empty()
+{
+  ref_type empty;
+  result_stream << empty.empty() << static_cast<bool>(empty) << empty(5) << " ";
+
+  auto func = [](int i) { return i * 3; };
+  ref_type r1 = func;
+  ref_type r2 = r1;
+  empty = r2;
+  result_stream << empty.empty() << static_cast<bool>(empty) << empty(5);
+  util->check_result(result_stream, "100 0115");
+}
+
+void
+test_void_and_references()
+{
+  std::string str;
+  auto append = [&str](const std::string& s) { str += s; };
+  sigc::slot_ref<void(const std::string&)> r = append;
+  r("abc");
+  r("def");
+
+  auto set = [](int& i) { i = 42; };
+  sigc::slot_ref<void(int&)> r2 = set;
+  int i = 0;
+  r2(i);
+  result_stream << str << i;
+  util->check_result(result_stream, "abcdef42");
+}
+
+const char*
+describe(sigc::slot_ref<int(int)>)
+{
+  return "int ";
+}
+
+const char*
+describe(sigc::slot_ref<std::string(const std::string&)>)
+{
+  return "string ";
+}
+
+void
+test_overloads()
+{
+  // The overload is chosen by the signature of the functor.
+  result_stream << describe([](int i) { return i; })
+                << describe([](const std::string& s) { return s; });
+  util->check_result(result_stream, "int string ");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_functors();
+  test_reference();
+  test_copy_and_empty();
+  test_void_and_references();
+  test_overloads();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
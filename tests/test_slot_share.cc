@@ -0,0 +1,235 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <sigc++/adaptors/track_obj.h>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+struct counted
+{
+  counted() { ++instances; }
+  counted(const counted&) { ++instances; }
+  ~counted() { --instances; }
+
+  void operator()(int i) const { result_stream << "counted(" << i << ") "; }
+
+  static int instances;
+};
+
+int counted::instances = 0;
+
+} // end anonymous namespace
+
+// Copies of user-defined functors are shared only on request.
+template<>
+struct sigc::slot_rep_sharing<counted> : public std::true_type
+{
+};
+
+namespace
+{
+
+struct mutable_counter
+{
+  int operator()() const { return ++n; }
+
+  mutable int n = 0;
+};
+
+struct A : public sigc::trackable
+{
+  void foo(int i) { result_stream << "A::foo(" << i << ") "; }
+};
+
+void
+bar(int)
+{
+}
+
+auto immutable_lambda = [](int) {};
+auto capturing_lambda = [n = 1](int) { static_cast<void>(n); };
+auto mutable_lambda = [](int) mutable {};
+auto generic_lambda = [](auto) {};
+
+static_assert(sigc::slot_rep_sharing<counted>::value);
+static_assert(sigc::slot_rep_sharing<decltype(immutable_lambda)>::value);
+static_assert(sigc::slot_rep_sharing<decltype(capturing_lambda)>::value);
+static_assert(sigc::slot_rep_sharing<decltype(&bar)>::value);
+static_assert(sigc::slot_rep_sharing<decltype(sigc::ptr_fun(&bar))>::value);
+static_assert(sigc::slot_rep_sharing<decltype(sigc::mem_fun(std::declval<A&>(), &A::foo))>::value);
+static_assert(sigc::slot_rep_sharing<decltype(
+    sigc::track_obj(immutable_lambda, std::declval<A&>()))>::value);
+static_assert(!sigc::slot_rep_sharing<decltype(mutable_lambda)>::value);
+static_assert(!sigc::slot_rep_sharing<decltype(generic_lambda)>::value);
+static_assert(!sigc::slot_rep_sharing<decltype(
+    sigc::track_obj(mutable_lambda, std::declval<A&>()))>::value);
+static_assert(!sigc::slot_rep_sharing<mutable_counter>::value);
+static_assert(!sigc::slot_rep_sharing<std::function<void(int)>>::value);
+static_assert(!sigc::slot_rep_sharing<sigc::slot<void(int)>>::value);
+
+void
+test_copy()
+{
+  {
+    sigc::slot<void(int)> s1 = counted();
+    sigc::slot<void(int)> s2 = s1;
+    sigc::slot<void(int)> s3;
+    s3 = s2;
+    result_stream << counted::instances << " ";
+    s3(1);
+
+    // A slot that is connected to a signal gets its own functor.
+    sigc::signal<void(int)> sig;
+    sig.connect(s1);
+    result_stream << counted::instances << " ";
+    sig(2);
+
+    s1 = sigc::slot<void(int)>();
+    s2 = sigc::slot<void(int)>();
+    result_stream << counted::instances << " ";
+    s3(3);
+  }
+  result_stream << counted::instances;
+  util->check_result(result_stream, "1 counted(1) 2 counted(2) 2 counted(3) 0");
+}
+
+void
+test_disconnect()
+{
+  // Disconnecting a slot doesn't invalidate the slots that share its functor.
+  sigc::slot<void(int)> s1 = counted();
+  sigc::slot<void(int)> s2 = s1;
+  s2.disconnect();
+  result_stream << s1.empty() << s2.empty() << counted::instances << " ";
+  s1(1);
+
+  // Neither does disconnecting a connection.
+  sigc::slot<void(int)> s3 = s1;
+  sigc::connection conn(s3);
+  result_stream << counted::instances << " ";
+  conn.disconnect();
+  result_stream << s1.empty() << s3.empty() << " ";
+  s1(2);
+  util->check_result(result_stream, "011 counted(1) 2 01 counted(2) ");
+}
+
+void
+test_move()
+{
+  sigc::slot<void(int)> s1 = counted();
+  sigc::slot<void(int)> s2 = s1;
+  sigc::slot<void(int)> s3(std::move(s2));
+  result_stream << static_cast<bool>(s2) << counted::instances << " ";
+  s2 = std::move(s3);
+  result_stream << static_cast<bool>(s3) << counted::instances << " ";
+  s2(1);
+  s1 = sigc::slot<void(int)>();
+  s2(2);
+  util->check_result(result_stream, "01 01 counted(1) counted(2) ");
+}
+
+void
+test_trackable()
+{
+  // The shared functor is invalidated when an object that it's bound to is destroyed.
+  sigc::slot<void(int)> s1;
+  sigc::slot<void(int)> s2;
+  {
+    A a;
+    s1 = sigc::mem_fun(a, &A::foo);
+    s2 = s1;
+    s2(1);
+  }
+  result_stream << s1.empty() << s2.empty();
+  util->check_result(result_stream, "A::foo(1) 11");
+}
+
+void
+test_mutable()
+{
+  // A mutable functor is copied, so each slot has its own state.
+  int n = 0;
+  sigc::slot<int()> s1 = [n]() mutable { return ++n; };
+  s1();
+  sigc::slot<int()> s2 = s1;
+  s1();
+  result_stream << s1() << s2();
+  util->check_result(result_stream, "32");
+
+  // So is a functor whose const operator()() modifies a mutable member.
+  sigc::slot<int()> s3 = mutable_counter();
+  s3();
+  sigc::slot<int()> s4 = s3;
+  s3();
+  result_stream << s3() << s4();
+  util->check_result(result_stream, "32");
+}
+
+void
+test_slot_in_slot()
+{
+  // A slot that becomes the inner slot of another slot gets its own functor.
+  sigc::slot<void(int)> inner = counted();
+  sigc::slot<void(int)> copy = inner;
+  sigc::slot<void(long)> outer = inner;
+  result_stream << counted::instances << " ";
+  outer(1);
+  copy.disconnect();
+  outer(2);
+  util->check_result(result_stream, "2 counted(1) counted(2) ");
+}
+
+void
+test_threads()
+{
+  // Slots that share a functor can be copied and destroyed in different threads.
+  const sigc::slot<void(int)> s = counted();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&s]() {
+      for (int i = 0; i < 1000; ++i)
+      {
+        sigc::slot<void(int)> copy = s;
+        sigc::slot<void(int)> other = copy;
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  result_stream << counted::instances;
+  util->check_result(result_stream, "1");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_copy();
+  test_disconnect();
+  test_move();
+  test_trackable();
+  test_mutable();
+  test_slot_in_slot();
+  test_threads();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
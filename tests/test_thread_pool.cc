@@ -0,0 +1,190 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/thread_pool.h>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+void
+test_parallel_for()
+{
+  sigc::thread_pool pool(3);
+  std::vector<int> done(1000, 0);
+  pool.parallel_for(done.size(), [&done](std::size_t i) { done[i] += 1; });
+
+  int sum = 0;
+  for (auto d : done)
+    sum += d;
+  result_stream << pool.size() << " " << sum;
+  util->check_result(result_stream, "3 1000");
+
+  // A pool without worker threads runs the tasks in the calling thread.
+  sigc::thread_pool empty_pool(0);
+  empty_pool.parallel_for(5, [](std::size_t i) { result_stream << i; });
+  util->check_result(result_stream, "01234");
+}
+
+void
+test_emit_parallel()
+{
+  sigc::thread_pool pool(3);
+  sigc::signal<std::string(int)> sig;
+  std::vector<sigc::connection> connections;
+  for (int i = 0; i < 20; ++i)
+    connections.push_back(
+      sig.connect([i](int a) { return std::to_string(i + a) + (i % 2 ? "," : ";"); }));
+  connections[3].block();
+
+  // The concatenation is associative, but not commutative.
+  const auto concat = [](std::string x, std::string y) { return x + y; };
+  result_stream << sig.emit_parallel(pool, std::string("<"), concat, 100);
+  util->check_result(result_stream,
+    "<100;101,102;104;105,106;107,108;109,110;111,112;113,114;115,116;117,118;119,");
+
+  std::atomic<int> n_calls(0);
+  sigc::signal<void()> void_sig;
+  for (int i = 0; i < 50; ++i)
+    void_sig.connect([&n_calls]() { ++n_calls; });
+  void_sig.emit_parallel(pool);
+  result_stream << n_calls;
+  util->check_result(result_stream, "50");
+
+  sigc::signal<int()> empty_sig;
+  result_stream << empty_sig.emit_parallel(pool, 7, std::plus<int>());
+  util->check_result(result_stream, "7");
+}
+
+void
+test_trackable_signal()
+{
+  sigc::thread_pool pool(2);
+  sigc::trackable_signal<int(int)> sig;
+  for (int i = 0; i < 10; ++i)
+    sig.connect([i](int a) { return i * a; });
+  result_stream << sig.emit_parallel(pool, 0, std::plus<int>(), 2);
+
+  std::atomic<int> n_calls(0);
+  sigc::trackable_signal<void()> void_sig;
+  for (int i = 0; i < 10; ++i)
+    void_sig.connect([&n_calls]() { ++n_calls; });
+  void_sig.emit_parallel(pool);
+  result_stream << " " << n_calls;
+  util->check_result(result_stream, "90 10");
+}
+
+// A combiner that must not be used by several threads.
+struct single_thread_plus
+{
+  single_thread_plus(std::atomic<int>& n_shared) : n_shared_(n_shared) {}
+  single_thread_plus(const single_thread_plus& src) : n_shared_(src.n_shared_) {}
+
+  int operator()(int x, int y)
+  {
+    if (owner_ == std::thread::id())
+      owner_ = std::this_thread::get_id();
+    else if (owner_ != std::this_thread::get_id())
+      ++n_shared_;
+    return x + y;
+  }
+
+  std::atomic<int>& n_shared_;
+  std::thread::id owner_;
+};
+
+void
+test_combiner_copies()
+{
+  // Each task combines its results with its own copy of the combiner.
+  sigc::thread_pool pool(3);
+  sigc::signal<int()> sig;
+  for (int i = 0; i < 100; ++i)
+    sig.connect([]() { return 1; });
+
+  std::atomic<int> n_shared(0);
+  int sum = 0;
+  for (int i = 0; i < 20; ++i)
+    sum += sig.emit_parallel(pool, 0, single_thread_plus(n_shared));
+  result_stream << sum << " " << n_shared;
+  util->check_result(result_stream, "2000 0");
+}
+
+void
+test_exception()
+{
+  sigc::thread_pool pool(2);
+  sigc::signal<int(int)> sig;
+  for (int i = 0; i < 10; ++i)
+  {
+    sig.connect(
+      [i](int a)
+      {
+        if (i == 5 && a == 1)
+          throw std::runtime_error("slot 5");
+        return a;
+      });
+  }
+
+  try
+  {
+    sig.emit_parallel(pool, 0, std::plus<int>(), 1);
+    result_stream << "no exception";
+  }
+  catch (const std::runtime_error& e)
+  {
+    result_stream << e.what();
+  }
+  util->check_result(result_stream, "slot 5");
+
+  // The pool is still usable.
+  result_stream << sig.emit_parallel(pool, 0, std::plus<int>(), 2);
+  util->check_result(result_stream, "20");
+}
+
+void
+test_nested()
+{
+  // A slot that is run by the pool emits another signal on the same pool.
+  sigc::thread_pool pool(2);
+  sigc::signal<int()> inner;
+  for (int i = 0; i < 8; ++i)
+    inner.connect([]() { return 1; });
+
+  sigc::signal<int()> outer;
+  for (int i = 0; i < 8; ++i)
+    outer.connect([&pool, &inner]() { return inner.emit_parallel(pool, 0, std::plus<int>()); });
+
+  result_stream << outer.emit_parallel(pool, 0, std::plus<int>());
+  util->check_result(result_stream, "64");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_parallel_for();
+  test_emit_parallel();
+  test_trackable_signal();
+  test_combiner_copies();
+  test_exception();
+  test_nested();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
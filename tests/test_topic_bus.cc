@@ -0,0 +1,154 @@
+/* Copyright 2026, The libsigc++ Development Team
+ *  Assigned to public domain.  Use as you wish without restriction.
+ */
+
+#include "testutilities.h"
+#include <sigc++/topic_bus.h>
+#include <sigc++/trackable.h>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+
+TestUtilities* util = nullptr;
+std::ostringstream result_stream;
+
+using bus_type = sigc::topic_bus<void(const std::string&)>;
+
+sigc::slot<void(const std::string&)>
+printer(const std::string& name)
+{
+  return [name](const std::string& topic) { result_stream << name << "(" << topic << ") "; };
+}
+
+struct A : public sigc::trackable
+{
+  void foo(const std::string& topic) { result_stream << "A::foo(" << topic << ") "; }
+};
+
+void
+test_patterns()
+{
+  bus_type bus;
+  bus.subscribe("market.nasdaq.trades", printer("exact"));
+  bus.subscribe("market.*.trades", printer("star"));
+  bus.subscribe("market.#", printer("hash"));
+  bus.subscribe("#.quotes", printer("quotes"));
+  bus.subscribe("*", printer("one"));
+
+  bus.publish("market.nasdaq.trades", "market.nasdaq.trades");
+  util->check_result(result_stream,
+    "exact(market.nasdaq.trades) star(market.nasdaq.trades) hash(market.nasdaq.trades) ");
+
+  bus.publish("market.nyse.trades", "market.nyse.trades");
+  util->check_result(result_stream, "star(market.nyse.trades) hash(market.nyse.trades) ");
+
+  bus.publish("market", "market");
+  util->check_result(result_stream, "hash(market) one(market) ");
+
+  bus.publish("market.nyse.quotes", "market.nyse.quotes");
+  util->check_result(result_stream, "hash(market.nyse.quotes) quotes(market.nyse.quotes) ");
+
+  bus.publish("weather", "weather");
+  bus.publish("weather.today", "weather.today");
+  util->check_result(result_stream, "one(weather) ");
+
+  result_stream << bus.count("market.nasdaq.trades") << bus.count("market.nyse.trades.x");
+  util->check_result(result_stream, "31");
+}
+
+void
+test_repeated_wildcards()
+{
+  // A pattern that can match along several paths is invoked once.
+  bus_type bus;
+  bus.subscribe("#.#", printer("hashes"));
+  bus.subscribe("a.#.b.#", printer("ab"));
+  bus.publish("a.b.b", "a.b.b");
+  util->check_result(result_stream, "ab(a.b.b) hashes(a.b.b) ");
+}
+
+void
+test_cache()
+{
+  // Subscribing to a new pattern updates the cached matches.
+  bus_type bus;
+  bus.subscribe("a.*", printer("first"));
+  bus.publish("a.b", "a.b");
+  bus.subscribe("a.b", printer("second"));
+  bus.subscribe("a.*", printer("third"));
+  bus.publish("a.b", "a.b");
+  util->check_result(result_stream, "first(a.b) second(a.b) first(a.b) third(a.b) ");
+}
+
+void
+test_disconnect()
+{
+  bus_type bus;
+  auto conn = bus.subscribe("a.*", printer("first"));
+  {
+    A a;
+    bus.subscribe("a.b", sigc::mem_fun(a, &A::foo));
+    bus.publish("a.b", "a.b");
+  }
+  util->check_result(result_stream, "A::foo(a.b) first(a.b) ");
+
+  conn.disconnect();
+  bus.publish("a.b", "a.b");
+  result_stream << bus.empty();
+  util->check_result(result_stream, "1");
+
+  bus.prune();
+  bus.subscribe("a.b", printer("again"));
+  bus.publish("a.b", "a.b");
+  util->check_result(result_stream, "again(a.b) ");
+
+  bus.clear();
+  bus.publish("a.b", "a.b");
+  result_stream << bus.empty() << bus.count("a.b");
+  util->check_result(result_stream, "10");
+}
+
+void
+test_during_publication()
+{
+  bus_type bus;
+  bus.subscribe("a.b", [&bus](const std::string& topic) {
+    result_stream << "first(" << topic << ") ";
+    if (topic != "a.b")
+      return;
+    // A new pattern is matched by a nested publication.
+    bus.subscribe("a.*", printer("nested"));
+    bus.publish("a.b", "a.b.nested");
+    bus.clear();
+    bus.subscribe("c", printer("c"));
+  });
+  bus.subscribe("a.b", printer("second"));
+  bus.publish("a.b", "a.b");
+  util->check_result(
+    result_stream, "first(a.b) first(a.b.nested) second(a.b.nested) nested(a.b.nested) ");
+
+  bus.publish("a.b", "a.b");
+  bus.publish("c", "c");
+  util->check_result(result_stream, "c(c) ");
+}
+
+} // end anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  util = TestUtilities::get_instance();
+
+  if (!util->check_command_args(argc, argv))
+    return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+  test_patterns();
+  test_repeated_wildcards();
+  test_cache();
+  test_disconnect();
+  test_during_publication();
+
+  return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
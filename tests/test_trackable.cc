@@ -5,9 +5,13 @@
 #include "testutilities.h"
 #include <sigc++/trackable.h>
 #include <sigc++/functors/slot.h>
+#include <sigc++/connection.h>
+#include <sigc++/adaptors/track_obj.h>
+#include <vector>
 
 namespace
 {
+TestUtilities* util = nullptr;
 std::ostringstream result_stream;
 
 class my_class : public sigc::trackable
@@ -18,12 +22,125 @@ public:
   void foo() { result_stream << i; }
 };
 
+void
+test_many_slots()
+{
+  // Remove some callbacks from the middle of the list, then destroy the trackable.
+  std::vector<sigc::slot<void()>> slots(1000);
+  std::vector<sigc::connection> connections;
+  {
+    my_class t;
+    t.i = 1;
+    for (auto& sl : slots)
+    {
+      sl = sigc::mem_fun(t, &my_class::foo);
+      connections.emplace_back(sl);
+    }
+
+    for (std::size_t i = 0; i < slots.size(); i += 3)
+      slots[i] = sigc::slot<void()>();
+
+    slots[1]();
+    util->check_result(result_stream, "1");
+  }
+
+  bool all_empty = true;
+  for (const auto& sl : slots)
+    all_empty = all_empty && sl.empty();
+  result_stream << all_empty;
+  util->check_result(result_stream, "1");
+
+  bool all_disconnected = true;
+  for (const auto& c : connections)
+    all_disconnected = all_disconnected && !c.connected();
+  result_stream << all_disconnected;
+  util->check_result(result_stream, "1");
+}
+
+class my_inline_class : public sigc::inline_trackable<2>
+{
+public:
+  int i = 0;
+
+  void foo() { result_stream << i; }
+};
+
+void
+test_reused_callbacks()
+{
+  // Slots that are destroyed leave room for the callbacks of new slots.
+  // The callbacks of the remaining slots are still found by their handles.
+  std::vector<sigc::slot<void()>> slots(100);
+  {
+    my_class t1;
+    my_class t2;
+    t1.i = 1;
+    t2.i = 2;
+    for (auto& sl : slots)
+      sl = sigc::mem_fun(t1, &my_class::foo);
+    for (std::size_t i = 0; i < slots.size(); i += 2)
+      slots[i] = sigc::slot<void()>();
+    for (std::size_t i = 0; i < slots.size(); i += 4)
+      slots[i] = sigc::track_obj([&t1, &t2]() { t1.foo(); t2.foo(); }, t1, t2);
+    for (std::size_t i = 0; i < slots.size(); i += 8)
+      slots[i] = sigc::slot<void()>();
+
+    slots[1]();
+    slots[4]();
+    util->check_result(result_stream, "112");
+
+    // Only the slots that track t2 are invalidated.
+    t2.notify_callbacks();
+    result_stream << slots[1].empty() << slots[4].empty();
+    util->check_result(result_stream, "01");
+  }
+
+  bool all_empty = true;
+  for (const auto& sl : slots)
+    all_empty = all_empty && sl.empty();
+  result_stream << all_empty;
+  util->check_result(result_stream, "1");
+}
+
+void
+test_inline_trackable()
+{
+  // The third slot doesn't fit in the inline storage.
+  sigc::slot<void()> sl1;
+  sigc::slot<void()> sl2;
+  sigc::slot<void()> sl3;
+  {
+    my_inline_class t;
+    t.i = 2;
+    sl1 = sigc::mem_fun(t, &my_inline_class::foo);
+    sl2 = sigc::mem_fun(t, &my_inline_class::foo);
+    sl3 = sigc::mem_fun(t, &my_inline_class::foo);
+    sl1();
+    sl3();
+    util->check_result(result_stream, "22");
+
+    // A copy is not tracked by the slots of the original.
+    my_inline_class t2(t);
+    t2.i = 3;
+    sigc::slot<void()> sl4 = sigc::mem_fun(t2, &my_inline_class::foo);
+    t2.notify_callbacks();
+    sl4();
+    sl2();
+    util->check_result(result_stream, "2");
+  }
+
+  sl1();
+  sl2();
+  sl3();
+  util->check_result(result_stream, "");
+}
+
 } // end anonymous namespace
 
 int
 main(int argc, char* argv[])
 {
-  auto util = TestUtilities::get_instance();
+  util = TestUtilities::get_instance();
 
   if (!util->check_command_args(argc, argv))
     return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
@@ -40,5 +157,9 @@ main(int argc, char* argv[])
   sl();
   util->check_result(result_stream, "");
 
+  test_many_slots();
+  test_reused_callbacks();
+  test_inline_trackable();
+
   return util->get_result_and_delete_instance() ? EXIT_SUCCESS : EXIT_FAILURE;
 }